@@ -80,6 +80,59 @@ public:
 	 */
 	virtual void muged_1D_ifft(muged_array& spectrum, muged_array& signal) = 0;
 
+	/**
+	 * @fn muged_1D_rfft(muged_real_array& signal, muged_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform of real signal
+	 *
+	 * @param signal - 1D real signal
+	 * @param spectrum - result, signal.length/2+1 spectrum bins (memory will be allocated)
+	 */
+	virtual void muged_1D_rfft(muged_real_array& signal, muged_array& spectrum) = 0;
+
+	/**
+	 * @fn muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of real signal spectrum
+	 *
+	 * @param spectrum - length/2+1 spectrum bins
+	 * @param length - number of signal samples
+	 * @param signal - result, real signal in time domain (memory will be allocated)
+	 */
+	virtual void muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal) = 0;
+
+	/**
+	 * @fn muged_1D_fft_batch(muged_array& signals, size_t length, size_t count, size_t stride, size_t distance, muged_array& spectra)
+	 *
+	 * Calculates 1D Fast Fourier Transform of many signals of the same length.
+	 * Sample n of signal k is signals.array[k*distance + n*stride].
+	 *
+	 * @param signals - 1D signals
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @param spectra - result, spectrum k starts at k*length (memory will be allocated)
+	 */
+	virtual void muged_1D_fft_batch(muged_array& signals, size_t length, size_t count,
+	                                size_t stride, size_t distance, muged_array& spectra) = 0;
+
+	/**
+	 * @fn muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count, size_t stride, size_t distance, muged_array& signals)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of many spectra of the same length.
+	 * Bin n of spectrum k is spectra.array[k*distance + n*stride].
+	 *
+	 * @param spectra - 1D signal spectra
+	 * @param length - length of each spectrum
+	 * @param count - number of spectra
+	 * @param stride - distance between bins of one spectrum
+	 * @param distance - distance between first bins of consecutive spectra
+	 * @param signals - result, signal k starts at k*length (memory will be allocated)
+	 */
+	virtual void muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count,
+	                                 size_t stride, size_t distance, muged_array& signals) = 0;
+
 	/**
 	 * @fn muged_2D_fft(muged_matrix& ssignal, muged_matrix& spectrum)
 	 *
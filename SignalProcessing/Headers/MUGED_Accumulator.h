@@ -0,0 +1,146 @@
+/**
+ * @file MUGED_Accumulator.h
+ * @date 2026-10-18
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains streaming accumulator of signal statistics
+ */
+
+#ifndef _MUGED_ACCUMULATOR_H_
+#define _MUGED_ACCUMULATOR_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+#include "MUGED_SampleView.h"
+
+/**
+ * @class MUGED_Accumulator
+ * @author Kamil Sorokosz
+ * @brief Running statistics of unbounded stream of complex samples
+ *
+ * Accumulator keeps number of samples, mean of real and imaginary parts and
+ * sums of squared deviations from it (Welford), so it doesn't lose precision
+ * when mean is large compared with deviation. Blocks are summed around current
+ * mean and joined like two accumulators (Chan et al.), so merge of partial
+ * accumulators (e.g. one per thread) takes O(1). Results are available at any
+ * moment and equal to statistics of all samples added so far.
+ */
+class MUGED_Accumulator
+{
+public:
+
+	/**
+	 * @fn MUGED_Accumulator()
+	 *
+	 * Creates empty accumulator
+	 */
+	MUGED_Accumulator() noexcept;
+
+	/**
+	 * @fn muged_add(const muged_scalar& sample)
+	 *
+	 * @param sample - next sample
+	 */
+	void muged_add(const muged_scalar& sample) noexcept;
+
+	/**
+	 * @fn muged_add(const muged_array& signal)
+	 *
+	 * @param signal - next block of samples
+	 */
+	void muged_add(const muged_array& signal) noexcept;
+
+	/**
+	 * @fn muged_add(const MUGED_SampleView& signal)
+	 *
+	 * @param signal - next block of samples in any format
+	 */
+	void muged_add(const MUGED_SampleView& signal) noexcept;
+
+	/**
+	 * @fn muged_merge(const MUGED_Accumulator& accumulator)
+	 *
+	 * Adds samples of other accumulator, as if they were added to this one
+	 *
+	 * @param accumulator - partial accumulator
+	 */
+	void muged_merge(const MUGED_Accumulator& accumulator) noexcept;
+
+	/**
+	 * @fn muged_reset()
+	 *
+	 * Removes all samples
+	 */
+	void muged_reset() noexcept;
+
+	/**
+	 * @fn muged_count() const
+	 *
+	 * @return size_t - number of samples added
+	 */
+	size_t muged_count() const noexcept;
+
+	/**
+	 * @fn muged_mean() const
+	 *
+	 * @return muged_scalar - mean
+	 */
+	muged_scalar muged_mean() const noexcept;
+
+	/**
+	 * @fn muged_mean_square() const
+	 *
+	 * @return muged_scalar - mean square (mean of z^2)
+	 */
+	muged_scalar muged_mean_square() const noexcept;
+
+	/**
+	 * @fn muged_root_mean_square() const
+	 *
+	 * @return muged_scalar - RMS
+	 */
+	muged_scalar muged_root_mean_square() const noexcept;
+
+	/**
+	 * @fn muged_standard_deviation() const
+	 *
+	 * @return muged_scalar - standard deviation (normalized with number of samples)
+	 */
+	muged_scalar muged_standard_deviation() const noexcept;
+
+	/**
+	 * @fn muged_snapshot() const
+	 *
+	 * @return muged_statistics - all statistics of samples added so far
+	 */
+	muged_statistics muged_snapshot() const noexcept;
+
+private:
+
+	/**
+	 * @fn muged_join(double count, double mean_real, double mean_imag,
+	 *                double real_real, double imag_imag, double real_imag)
+	 *
+	 * Joins moments of other samples (Chan et al.)
+	 */
+	void muged_join(double count, double mean_real, double mean_imag,
+	                double real_real, double imag_imag, double real_imag) noexcept;
+
+	/// Number of samples
+	size_t count;
+
+	/// Mean of real and imaginary parts
+	double mean_real;
+	double mean_imag;
+
+	/// Sums of products of deviations from mean
+	double real_real;
+	double imag_imag;
+	double real_imag;
+
+	/// Smallest and largest |z|^2
+	double min_norm;
+	double max_norm;
+};
+
+#endif /* _MUGED_ACCUMULATOR_H_ */
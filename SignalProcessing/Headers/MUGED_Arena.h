@@ -0,0 +1,204 @@
+/**
+ * @file MUGED_Arena.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains bump allocator of temporary memory
+ */
+
+#ifndef _MUGED_ARENA_H_
+#define _MUGED_ARENA_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @struct _muged_arena_mark_
+ * Position in arena, memory allocated after it is released together
+ */
+struct _muged_arena_mark_
+{
+	size_t block;
+	size_t used;
+	size_t in_use;
+};
+
+/**
+ * @typedef muged_arena_mark
+ * @brief Position in arena
+ */
+typedef _muged_arena_mark_ muged_arena_mark;
+
+/**
+ * @class MUGED_Arena
+ * @author Kamil Sorokosz
+ * @brief Bump allocator of temporary (scratch) memory
+ *
+ * Memory is taken from aligned blocks by moving pointer and released in reverse
+ * order by returning to earlier mark (see MUGED_ArenaScope). Request which doesn't
+ * fit in current block adds new block. When all memory is released, blocks are
+ * replaced with one block of peak size, so steady state processing allocates
+ * nothing from heap. Arena is not thread-safe.
+ */
+class MUGED_Arena
+{
+public:
+
+	/**
+	 * @fn MUGED_Arena(size_t capacity)
+	 *
+	 * @param capacity - bytes allocated up front
+	 */
+	explicit MUGED_Arena(size_t capacity = 0);
+
+	/**
+	 * Default destructor. Frees blocks.
+	 */
+	~MUGED_Arena();
+
+	/**
+	 * @fn muged_allocate(size_t bytes)
+	 *
+	 * @param bytes - size of memory
+	 * @return void* - memory aligned to MUGED_ALIGNMENT bytes, valid until release
+	 *                 of earlier mark (std::bad_alloc is thrown on failure)
+	 */
+	void* muged_allocate(size_t bytes);
+
+	/**
+	 * @fn muged_allocate(size_t count)
+	 *
+	 * @param count - number of elements, they are not initialized
+	 * @return T* - memory for count elements of trivially copyable type T
+	 */
+	template <class T>
+	T* muged_allocate(size_t count)
+	{
+		return (T*)muged_allocate(count * sizeof(T));
+	}
+
+	/**
+	 * @fn muged_mark() const
+	 *
+	 * @return muged_arena_mark - current position
+	 */
+	muged_arena_mark muged_mark() const;
+
+	/**
+	 * @fn muged_release(const muged_arena_mark& mark)
+	 *
+	 * Releases memory allocated after mark
+	 *
+	 * @param mark - earlier position
+	 */
+	void muged_release(const muged_arena_mark& mark);
+
+	/**
+	 * @fn muged_reserve(size_t bytes)
+	 *
+	 * Makes sure that bytes can be allocated without heap allocation,
+	 * may be called only when no memory is in use
+	 *
+	 * @param bytes - size of memory
+	 */
+	void muged_reserve(size_t bytes);
+
+	/**
+	 * @fn muged_in_use() const
+	 *
+	 * @return size_t - bytes allocated and not released
+	 */
+	size_t muged_in_use() const;
+
+	/**
+	 * @fn muged_peak() const
+	 *
+	 * @return size_t - largest number of bytes in use at once (high-water mark)
+	 */
+	size_t muged_peak() const;
+
+	/**
+	 * @fn muged_capacity() const
+	 *
+	 * @return size_t - bytes of all blocks
+	 */
+	size_t muged_capacity() const;
+
+	/**
+	 * @fn muged_heap_allocations() const
+	 *
+	 * @return size_t - number of blocks allocated from heap so far
+	 */
+	size_t muged_heap_allocations() const;
+
+	/**
+	 * @fn muged_reset_statistics()
+	 *
+	 * Sets peak to bytes in use and number of heap allocations to 0
+	 */
+	void muged_reset_statistics();
+
+private:
+
+	MUGED_Arena(const MUGED_Arena& arena);
+	MUGED_Arena& operator=(const MUGED_Arena& arena);
+
+	/**
+	 * @fn muged_add_block(size_t bytes)
+	 *
+	 * Makes block after current one at least bytes long and current
+	 */
+	void muged_add_block(size_t bytes);
+
+	/**
+	 * @fn muged_coalesce()
+	 *
+	 * Replaces blocks with one block of peak size, nothing may be in use
+	 */
+	void muged_coalesce();
+
+	/// Blocks, sizes and their number
+	char** blocks;
+	size_t* sizes;
+	size_t count;
+	size_t slots;
+
+	/// Current block and bytes used in it
+	size_t current;
+	size_t used;
+
+	/// Statistics
+	size_t in_use;
+	size_t peak;
+	size_t heap_allocations;
+};
+
+/**
+ * @class MUGED_ArenaScope
+ * @author Kamil Sorokosz
+ * @brief Releases memory allocated from arena during its lifetime, also when exception is thrown
+ */
+class MUGED_ArenaScope
+{
+public:
+
+	explicit MUGED_ArenaScope(MUGED_Arena& arena)
+		: arena(arena), mark(arena.muged_mark())
+	{
+	}
+
+	~MUGED_ArenaScope()
+	{
+		arena.muged_release(mark);
+	}
+
+private:
+
+	MUGED_ArenaScope(const MUGED_ArenaScope& scope);
+	MUGED_ArenaScope& operator=(const MUGED_ArenaScope& scope);
+
+	MUGED_Arena& arena;
+	muged_arena_mark mark;
+};
+
+#endif /* _MUGED_ARENA_H_ */
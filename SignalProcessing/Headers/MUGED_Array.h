@@ -0,0 +1,571 @@
+/**
+ * @file MUGED_Array.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains owning arrays with aligned storage and move semantics
+ */
+
+#ifndef _MUGED_ARRAY_H_
+#define _MUGED_ARRAY_H_
+
+#include <utility>
+#include <algorithm>
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+#include "MUGED_Memory.h"
+
+/**
+ * @enum MUGED_Initialization
+ * @brief Initialization of samples of new owning array or matrix
+ */
+enum MUGED_Initialization
+{
+	/// Every sample equals zero
+	MUGED_ZERO_INITIALIZED,
+
+	/// Samples are not initialized, e.g. for results which will be overwritten anyway
+	MUGED_UNINITIALIZED
+};
+
+/**
+ * @class MUGED_AlignedArray
+ * @author Kamil Sorokosz
+ * @brief Array owning its samples, T is sample type and V plain array type viewing them
+ *
+ * Samples are allocated with muged_aligned_alloc (MUGED_ALIGNMENT bytes) and freed
+ * by destructor. Array can be moved but not copied, copy has to be made explicitly
+ * from view. Array converts to its view (muged_array or muged_real_array), so it can
+ * be passed to every function taking plain arrays.
+ *
+ * @see MUGED_Array, MUGED_RealArray
+ */
+template <class T, class V>
+class MUGED_AlignedArray
+{
+public:
+
+	/**
+	 * @fn MUGED_AlignedArray()
+	 *
+	 * Creates empty array
+	 */
+	MUGED_AlignedArray() noexcept
+	{
+		this->view.array = NULL;
+		this->view.length = 0;
+	}
+
+	/**
+	 * @fn MUGED_AlignedArray(size_t length, MUGED_Initialization initialization)
+	 *
+	 * Allocates array
+	 *
+	 * @param length - number of samples
+	 * @param initialization - zero or uninitialized samples
+	 */
+	explicit MUGED_AlignedArray(size_t length, MUGED_Initialization initialization = MUGED_ZERO_INITIALIZED)
+	{
+		this->view.array = length > 0 ? (T*)muged_aligned_alloc(length * sizeof(T)) : NULL;
+		this->view.length = length;
+
+		if (initialization == MUGED_ZERO_INITIALIZED && length > 0)
+			std::fill(this->view.array, this->view.array + length, T());
+	}
+
+	/**
+	 * @fn MUGED_AlignedArray(const V& source)
+	 *
+	 * Copies samples of plain array
+	 *
+	 * @param source - array
+	 */
+	explicit MUGED_AlignedArray(const V& source)
+		: MUGED_AlignedArray(source.length, MUGED_UNINITIALIZED)
+	{
+		if (source.length > 0)
+			std::copy(source.array, source.array + source.length, this->view.array);
+	}
+
+	/**
+	 * @fn MUGED_AlignedArray(MUGED_AlignedArray&& array)
+	 *
+	 * Takes samples of other array, which becomes empty
+	 */
+	MUGED_AlignedArray(MUGED_AlignedArray&& array) noexcept
+		: view(array.view)
+	{
+		array.view.array = NULL;
+		array.view.length = 0;
+	}
+
+	/**
+	 * @fn operator=(MUGED_AlignedArray&& array)
+	 *
+	 * Exchanges samples with other array, own samples are freed together with it
+	 */
+	MUGED_AlignedArray& operator=(MUGED_AlignedArray&& array) noexcept
+	{
+		std::swap(this->view, array.view);
+		return *this;
+	}
+
+	/**
+	 * Default destructor. Frees samples.
+	 */
+	~MUGED_AlignedArray()
+	{
+		muged_aligned_free(this->view.array);
+	}
+
+	/**
+	 * @fn muged_length() const
+	 *
+	 * @return size_t - number of samples
+	 */
+	size_t muged_length() const noexcept
+	{
+		return this->view.length;
+	}
+
+	/**
+	 * @fn muged_data()
+	 *
+	 * @return T* - samples
+	 */
+	T* muged_data() noexcept
+	{
+		return this->view.array;
+	}
+
+	const T* muged_data() const noexcept
+	{
+		return this->view.array;
+	}
+
+	T& operator[](size_t i) noexcept
+	{
+		return this->view.array[i];
+	}
+
+	const T& operator[](size_t i) const noexcept
+	{
+		return this->view.array[i];
+	}
+
+	/**
+	 * @fn muged_view()
+	 *
+	 * @return V& - plain array viewing samples, valid as long as this array owns them.
+	 * Samples can be changed, but must not be reallocated or freed through the view.
+	 * Only const conversion is implicit, so owning array cannot be passed by mistake
+	 * to functions allocating their output.
+	 */
+	V& muged_view() noexcept
+	{
+		return this->view;
+	}
+
+	const V& muged_view() const noexcept
+	{
+		return this->view;
+	}
+
+	operator const V&() const noexcept
+	{
+		return this->view;
+	}
+
+private:
+
+	MUGED_AlignedArray(const MUGED_AlignedArray& array);
+	MUGED_AlignedArray& operator=(const MUGED_AlignedArray& array);
+
+	/// Samples and their number
+	V view;
+};
+
+/**
+ * @typedef MUGED_Array
+ * @brief Owning 1D complex array
+ */
+typedef MUGED_AlignedArray<muged_scalar, muged_array> MUGED_Array;
+
+/**
+ * @typedef MUGED_RealArray
+ * @brief Owning 1D real array
+ */
+typedef MUGED_AlignedArray<double, muged_real_array> MUGED_RealArray;
+
+/**
+ * @class MUGED_StridedView
+ * @author Kamil Sorokosz
+ * @brief Non-owning view of samples placed every stride samples, e.g. matrix column
+ */
+class MUGED_StridedView
+{
+public:
+
+	/**
+	 * @fn MUGED_StridedView(muged_scalar* data, size_t length, size_t stride)
+	 *
+	 * @param data - first sample
+	 * @param length - number of samples
+	 * @param stride - distance between consecutive samples
+	 */
+	MUGED_StridedView(muged_scalar* data, size_t length, size_t stride) noexcept
+		: data(data), length(length), stride(stride)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->length;
+	}
+
+	size_t muged_stride() const noexcept
+	{
+		return this->stride;
+	}
+
+	muged_scalar* muged_data() const noexcept
+	{
+		return this->data;
+	}
+
+	muged_scalar& operator[](size_t i) const noexcept
+	{
+		return this->data[i * this->stride];
+	}
+
+private:
+
+	muged_scalar* data;
+	size_t length;
+	size_t stride;
+};
+
+/**
+ * @class MUGED_MatrixView
+ * @author Kamil Sorokosz
+ * @brief Non-owning view of matrix stored row by row with row stride
+ *
+ * Row r starts at data + r*stride. Rows, columns and tiles of view are views
+ * of the same samples, nothing is copied. Views are cheap and passed by value.
+ */
+class MUGED_MatrixView
+{
+public:
+
+	/**
+	 * @fn MUGED_MatrixView()
+	 *
+	 * Creates empty view
+	 */
+	MUGED_MatrixView() noexcept
+		: data(NULL), rows(0), cols(0), stride(0)
+	{
+	}
+
+	/**
+	 * @fn MUGED_MatrixView(muged_scalar* data, size_t rows, size_t cols, size_t stride)
+	 *
+	 * @param data - first sample of first row
+	 * @param rows - number of rows
+	 * @param cols - number of columns
+	 * @param stride - distance between first samples of consecutive rows, at least cols
+	 */
+	MUGED_MatrixView(muged_scalar* data, size_t rows, size_t cols, size_t stride) noexcept
+		: data(data), rows(rows), cols(cols), stride(stride)
+	{
+	}
+
+	/**
+	 * @fn MUGED_MatrixView(const muged_matrix& matrix)
+	 *
+	 * Adapts plain matrix whose rows are equally spaced, e.g. result of
+	 * MUGED_DSP::muged_2D_fft. ERR_MATRIX_LAYOUT is thrown otherwise.
+	 *
+	 * @param matrix - matrix
+	 * @see muged_strided(const muged_matrix& matrix)
+	 */
+	explicit MUGED_MatrixView(const muged_matrix& matrix);
+
+	size_t muged_rows() const noexcept
+	{
+		return this->rows;
+	}
+
+	size_t muged_cols() const noexcept
+	{
+		return this->cols;
+	}
+
+	/**
+	 * @fn muged_stride() const
+	 *
+	 * @return size_t - distance between first samples of consecutive rows
+	 */
+	size_t muged_stride() const noexcept
+	{
+		return this->stride;
+	}
+
+	muged_scalar* muged_data() const noexcept
+	{
+		return this->data;
+	}
+
+	/**
+	 * @fn muged_contiguous() const
+	 *
+	 * @return bool - true if there are no gaps between rows
+	 */
+	bool muged_contiguous() const noexcept
+	{
+		return this->stride == this->cols || this->rows <= 1;
+	}
+
+	muged_scalar* operator[](size_t row) const noexcept
+	{
+		return this->data + row * this->stride;
+	}
+
+	/**
+	 * @fn muged_row(size_t row) const
+	 *
+	 * @param row - index of row
+	 * @return muged_array - samples of row, may be passed to every 1D function
+	 */
+	muged_array muged_row(size_t row) const noexcept
+	{
+		muged_array view;
+		view.array = this->data + row * this->stride;
+		view.length = this->cols;
+		return view;
+	}
+
+	/**
+	 * @fn muged_column(size_t column) const
+	 *
+	 * @param column - index of column
+	 * @return MUGED_StridedView - samples of column
+	 */
+	MUGED_StridedView muged_column(size_t column) const noexcept
+	{
+		return MUGED_StridedView(this->data + column, this->rows, this->stride);
+	}
+
+	/**
+	 * @fn muged_tile(size_t row, size_t column, size_t rows, size_t cols) const
+	 *
+	 * Returns view of sub-matrix, ERR_MATRIX_RANGE is thrown if it doesn't fit in this view
+	 *
+	 * @param row - first row of tile
+	 * @param column - first column of tile
+	 * @param rows - number of rows of tile
+	 * @param cols - number of columns of tile
+	 * @return MUGED_MatrixView - tile with the same stride
+	 */
+	MUGED_MatrixView muged_tile(size_t row, size_t column, size_t rows, size_t cols) const
+	{
+		if (row + rows > this->rows || column + cols > this->cols)
+			throw new MUGED_DSPException(ERR_MATRIX_RANGE);
+
+		return MUGED_MatrixView(this->data + row * this->stride + column, rows, cols, this->stride);
+	}
+
+private:
+
+	muged_scalar* data;
+	size_t rows;
+	size_t cols;
+	size_t stride;
+};
+
+/**
+ * @fn muged_strided(const muged_matrix& matrix)
+ *
+ * @param matrix - plain matrix
+ * @return bool - true if rows are equally spaced and matrix can be adapted by MUGED_MatrixView
+ */
+bool muged_strided(const muged_matrix& matrix);
+
+/**
+ * @class MUGED_Matrix
+ * @author Kamil Sorokosz
+ * @brief Matrix owning its samples
+ *
+ * Rows are stored one after another in one aligned block. Row stride is rounded
+ * up to MUGED_ALIGNMENT bytes, so every row starts aligned. Rows, columns and
+ * tiles are available as views (muged_strided_view()). Row pointers of plain
+ * view (muged_view()) point into the same block. Matrix can be moved but not copied.
+ */
+class MUGED_Matrix
+{
+public:
+
+	/**
+	 * @fn MUGED_Matrix()
+	 *
+	 * Creates empty matrix
+	 */
+	MUGED_Matrix() noexcept;
+
+	/**
+	 * @fn MUGED_Matrix(size_t rows, size_t cols, MUGED_Initialization initialization)
+	 *
+	 * Allocates matrix
+	 *
+	 * @param rows - number of rows
+	 * @param cols - number of columns
+	 * @param initialization - zero or uninitialized samples
+	 */
+	MUGED_Matrix(size_t rows, size_t cols, MUGED_Initialization initialization = MUGED_ZERO_INITIALIZED);
+
+	/**
+	 * @fn MUGED_Matrix(const muged_matrix& source)
+	 *
+	 * Copies samples of plain matrix
+	 *
+	 * @param source - matrix
+	 */
+	explicit MUGED_Matrix(const muged_matrix& source);
+
+	/**
+	 * @fn MUGED_Matrix(const MUGED_MatrixView& source)
+	 *
+	 * Copies samples of view, e.g. tile of other matrix
+	 *
+	 * @param source - view
+	 */
+	explicit MUGED_Matrix(const MUGED_MatrixView& source);
+
+	/**
+	 * @fn MUGED_Matrix(MUGED_Matrix&& matrix)
+	 *
+	 * Takes samples of other matrix, which becomes empty
+	 */
+	MUGED_Matrix(MUGED_Matrix&& matrix) noexcept;
+
+	/**
+	 * @fn operator=(MUGED_Matrix&& matrix)
+	 *
+	 * Exchanges samples with other matrix, own samples are freed together with it
+	 */
+	MUGED_Matrix& operator=(MUGED_Matrix&& matrix) noexcept;
+
+	/**
+	 * Default destructor. Frees samples.
+	 */
+	~MUGED_Matrix();
+
+	/**
+	 * @fn muged_rows() const
+	 *
+	 * @return size_t - number of rows
+	 */
+	size_t muged_rows() const noexcept
+	{
+		return this->view.rows;
+	}
+
+	/**
+	 * @fn muged_cols() const
+	 *
+	 * @return size_t - number of columns
+	 */
+	size_t muged_cols() const noexcept
+	{
+		return this->view.cols;
+	}
+
+	/**
+	 * @fn muged_stride() const
+	 *
+	 * @return size_t - distance between first samples of consecutive rows
+	 */
+	size_t muged_stride() const noexcept
+	{
+		return this->stride;
+	}
+
+	/**
+	 * @fn muged_data()
+	 *
+	 * @return muged_scalar* - samples, row r starts at r*muged_stride()
+	 */
+	muged_scalar* muged_data() noexcept
+	{
+		return this->data;
+	}
+
+	const muged_scalar* muged_data() const noexcept
+	{
+		return this->data;
+	}
+
+	/**
+	 * @param row - index of row
+	 * @return muged_scalar* - samples of row
+	 */
+	muged_scalar* operator[](size_t row) noexcept
+	{
+		return this->data + row * this->stride;
+	}
+
+	const muged_scalar* operator[](size_t row) const noexcept
+	{
+		return this->data + row * this->stride;
+	}
+
+	/**
+	 * @fn muged_strided_view()
+	 *
+	 * @return MUGED_MatrixView - view of whole matrix, source of row, column and tile views
+	 */
+	MUGED_MatrixView muged_strided_view() noexcept
+	{
+		return MUGED_MatrixView(this->data, this->view.rows, this->view.cols, this->stride);
+	}
+
+	/**
+	 * @fn muged_view()
+	 *
+	 * @return muged_matrix& - plain matrix viewing samples, valid as long as this matrix owns them.
+	 * Samples can be changed, but must not be reallocated or freed through the view.
+	 * Only const conversion is implicit, so owning matrix cannot be passed by mistake
+	 * to functions allocating their output.
+	 */
+	muged_matrix& muged_view() noexcept
+	{
+		return this->view;
+	}
+
+	const muged_matrix& muged_view() const noexcept
+	{
+		return this->view;
+	}
+
+	operator const muged_matrix&() const noexcept
+	{
+		return this->view;
+	}
+
+private:
+
+	MUGED_Matrix(const MUGED_Matrix& matrix);
+	MUGED_Matrix& operator=(const MUGED_Matrix& matrix);
+
+	/// Block of samples
+	muged_scalar* data;
+
+	/// Distance between rows
+	size_t stride;
+
+	/// Row pointers into data and dimensions
+	muged_matrix view;
+};
+
+#endif /* _MUGED_ARRAY_H_ */
@@ -9,6 +9,9 @@
 #ifndef _MUGED_COMPLEX_H_
 #define _MUGED_COMPLEX_H_
 
+#include <complex>
+#include <type_traits>
+
 #include "MUGED_Definitions.h"
 
 /**
@@ -25,6 +28,12 @@
  * - calculate power, e.g square power
  * - calculate root, e.g square root
  *
+ * Arithmetic works on real and imaginary parts directly, polar form
+ * (abs, angle) is used only by non-integer powers and roots.
+ *
+ * Class is trivially copyable and has the layout of std::complex<double>
+ * and double[2], so arrays may be copied with memcpy and reinterpreted
+ * (see muged_as_std_complex, muged_as_doubles) without conversion.
  */
 class MUGED_Complex
 {
@@ -33,7 +42,7 @@ public:
 	/**
 	 * Default contructor. Complex value equals 0 + 0i
 	 */
-	MUGED_Complex();
+	constexpr MUGED_Complex() noexcept;
 
 	/**
 	 * Contructs complex value
@@ -43,26 +52,7 @@ public:
 	 * @param flag - if true arguments are treated as real and imaginary parts, otherwise
 	 * as absolute and angle of complex value. For default flag equals false.
 	 */
-	MUGED_Complex(double real_abs, double imag_angle, bool flag = true);
-
-	/**
-	 * Default copy contructor
-	 * @param scalar - complex value
-	 */
-	MUGED_Complex(const MUGED_Complex& scalar);
-
-	/**
-	 * Default destructor
-	 */
-	~MUGED_Complex();
-
-	/**
-	 * Assign the current complex value to specified
-	 *
-	 * @param scalar - specified complex
-	 * @return MUGED_Complex - complex value equal to specified
-	 */
-	MUGED_Complex& operator=(const MUGED_Complex& scalar);
+	MUGED_Complex(double real_abs, double imag_angle, bool flag = true) noexcept;
 
 	/**
 	 * @fn muged_real() const
@@ -70,7 +60,7 @@ public:
 	 * Returns real part of complex value
 	 * @return double - real part
 	 */
-	double muged_real() const;
+	constexpr double muged_real() const noexcept;
 
 	/**
 	 * @fn muged_imag() const
@@ -78,7 +68,7 @@ public:
 	 * Returns imaginary part of complex value
 	 * @return double - imaginary part
 	 */
-	double muged_imag() const;
+	constexpr double muged_imag() const noexcept;
 
 	/**
 	 * @fn muged_abs() const
@@ -86,7 +76,7 @@ public:
 	 * Calculates absolute value of current complex
 	 * @return double - absolute value of current complex
 	 */
-	double muged_abs() const;
+	double muged_abs() const noexcept;
 
 	/**
 	 * @fn muged_angle() const
@@ -94,13 +84,13 @@ public:
 	 * Calculates angle of current complex
 	 * @return double - angle of current complex
 	 */
-	double muged_angle() const;
+	double muged_angle() const noexcept;
 
 	/**
 	 * Calculates conjugation of current complex value
 	 * @return MUGED_Complex - complex value
 	 */
-	MUGED_Complex muged_conj();
+	constexpr MUGED_Complex muged_conj() const noexcept;
 
 	/**
 	 * @fn operator+(const MUGED_Complex& scalar)
@@ -110,7 +100,7 @@ public:
 	 * @param scalar - complex value
 	 * @return MUGED_Complex - sum of input and current complex value
 	 */
-	MUGED_Complex operator+(const MUGED_Complex& scalar);
+	MUGED_Complex operator+(const MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * Calculates sum of two complex values [friend function]
@@ -119,7 +109,7 @@ public:
 	 * @param scalar2 - second complex value
 	 * @return MUGED_Complex - sum of input complex values
 	 */
-  friend MUGED_Complex operator+(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2);
+  friend constexpr MUGED_Complex operator+(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2) noexcept;
 
   /**
    * Calculates sum of current complex value and input complex.
@@ -127,7 +117,7 @@ public:
    *
    * @param scalar - complex value
    */
-  void operator+=(const MUGED_Complex& scalar);
+  void operator+=(const MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * @fn operator-(const MUGED_Complex& scalar)
@@ -137,7 +127,7 @@ public:
 	 * @param scalar - complex value
 	 * @return MUGED_Complex - difference between input and current complex value
 	 */
-	MUGED_Complex operator-(const MUGED_Complex& scalar);
+	MUGED_Complex operator-(const MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * Calculates difference between two complex values [friend function]
@@ -146,7 +136,7 @@ public:
 	 * @param scalar2 - second complex value
 	 * @return MUGED_Complex - difference between input complex values
 	 */
-	friend MUGED_Complex operator-(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2);
+	friend constexpr MUGED_Complex operator-(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2) noexcept;
 
 	/**
 	 * Calculates difference between current complex value and input complex.
@@ -154,7 +144,7 @@ public:
 	 *
 	 * @param scalar - complex value
 	 */
-	void operator-=(const MUGED_Complex& scalar);
+	void operator-=(const MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * Multiplies current complex value and input argument
@@ -162,7 +152,7 @@ public:
 	 * @param scalar - complex value
 	 * @return MUGED_Complex - complex value
 	 */
-	MUGED_Complex operator*(MUGED_Complex& scalar);
+	MUGED_Complex operator*(MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * Multiplies input complex values
@@ -171,7 +161,7 @@ public:
 	 * @param scalar2 - second complex value
 	 * @return MUGED_Complex - complex value
 	 */
-	friend MUGED_Complex operator*(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2);
+	friend constexpr MUGED_Complex operator*(const MUGED_Complex& scalar1, const MUGED_Complex& scalar2) noexcept;
 
 	/**
 	 * Divides current complex by specified double precision number
@@ -179,7 +169,7 @@ public:
 	 * @param value - specified double precision number
 	 * @return MUGED_Complex - complex value
 	 */
-	MUGED_Complex operator/(double value);
+	MUGED_Complex operator/(double value) noexcept;
 
 	/**
 	 * Divides current complex by specified double precision number
@@ -187,7 +177,7 @@ public:
 	 *
 	 * @param value - specified double precision number
 	 */
-	void operator/=(double value);
+	void operator/=(double value) noexcept;
 
 	/**
 	 * Divides current complex value by another complex
@@ -195,37 +185,48 @@ public:
 	 * @param scalar - specified complex value
 	 * @return MUGED_Complex - division result
 	 */
-	MUGED_Complex operator/(MUGED_Complex& scalar);
+	MUGED_Complex operator/(MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * Divides current complex value by another complex
 	 *
 	 * @param scalar - specified complex value
 	 */
-	void operator/=(MUGED_Complex& scalar);
+	void operator/=(MUGED_Complex& scalar) noexcept;
 
 	/**
 	 * @fn muged_pow()
 	 *
-	 * Calculates power of complex value
+	 * Calculates power of complex value. Integer exponents up to
+	 * MUGED_COMPLEX_INTEGER_POWER are calculated by repeated squaring,
+	 * other ones in polar form.
 	 *
 	 * @param exp - exponent (default: 2)
 	 * @return MUGED_Complex - power of input value
 	 */
-	MUGED_Complex muged_pow(double exp = 2);
+	MUGED_Complex muged_pow(double exp = 2) noexcept;
 
 	/**
 	 * @fn muged_sqrt()
 	 *
-	 * Calculates square root of complex value
+	 * Calculates root of complex value (principal one). Square root is
+	 * calculated without trigonometric functions.
 	 *
 	 * @param exp - exponent (default: 2)
 	 * @return MUGED_Complex - square root of input value
 	 */
-	MUGED_Complex muged_sqrt(double exp = 2);
+	MUGED_Complex muged_sqrt(double exp = 2) noexcept;
 
 private:
 
+	/// Tag of constructor usable in constant expressions (polar form needs cos and sin)
+	struct muged_cartesian {};
+
+	/**
+	 * Contructs complex value from real and imaginary parts
+	 */
+	constexpr MUGED_Complex(double real_part, double imag_part, muged_cartesian) noexcept;
+
 	/// Real part of complex value
 	double real;
 
@@ -234,58 +235,33 @@ private:
 };
 
 
-inline MUGED_Complex::MUGED_Complex()
-{
-	real = INIT;
-	imaginary = INIT;
-}
-
-inline MUGED_Complex::MUGED_Complex(double real_abs, double imag_angle, bool flag)
-{
-	if (flag)
-	{
-		this->real = real_abs;
-		this->imaginary = imag_angle;
-	}
-	else
-	{
-		this->real = real_abs * cos(imag_angle);
-		this->imaginary = real_abs * sin(imag_angle);
-	}
-
-}
-
-inline MUGED_Complex::MUGED_Complex(const MUGED_Complex& scalar)
+constexpr MUGED_Complex::MUGED_Complex() noexcept
+	: real(INIT), imaginary(INIT)
 {
-	real = scalar.real;
-	imaginary = scalar.imaginary;
 }
 
-inline MUGED_Complex::~MUGED_Complex()
+inline MUGED_Complex::MUGED_Complex(double real_abs, double imag_angle, bool flag) noexcept
+	: real(flag ? real_abs : real_abs * cos(imag_angle)),
+	  imaginary(flag ? imag_angle : real_abs * sin(imag_angle))
 {
-	real = INIT;
-	imaginary = INIT;
 }
 
-inline MUGED_Complex& MUGED_Complex::operator=(const MUGED_Complex& scalar)
+constexpr MUGED_Complex::MUGED_Complex(double real_part, double imag_part, muged_cartesian) noexcept
+	: real(real_part), imaginary(imag_part)
 {
-	real = scalar.muged_real();
-	imaginary = scalar.muged_imag();
-
-	return (*this);
 }
 
-inline double MUGED_Complex::muged_real() const
+constexpr double MUGED_Complex::muged_real() const noexcept
 {
 	return this->real;
 }
 
-inline double MUGED_Complex::muged_imag() const
+constexpr double MUGED_Complex::muged_imag() const noexcept
 {
 	return this->imaginary;
 }
 
-inline double MUGED_Complex::muged_abs() const
+inline double MUGED_Complex::muged_abs() const noexcept
 {
 	double real = this->real;
 	double imag = this->imaginary;
@@ -293,7 +269,7 @@ inline double MUGED_Complex::muged_abs() const
 	return sqrt(real*real + imag*imag);
 }
 
-inline double MUGED_Complex::muged_angle() const
+inline double MUGED_Complex::muged_angle() const noexcept
 {
 	double real = this->real;
 	double imag = this->imaginary;
@@ -301,128 +277,109 @@ inline double MUGED_Complex::muged_angle() const
 	return atan2(imag,real);
 }
 
-inline MUGED_Complex MUGED_Complex::muged_conj()
+constexpr MUGED_Complex MUGED_Complex::muged_conj() const noexcept
 {
-	MUGED_Complex complex;
-	complex.real = this->real;
-	complex.imaginary = -this->imaginary;
-
-	return complex;
+	return MUGED_Complex(this->real, -this->imaginary, muged_cartesian());
 }
 
-inline MUGED_Complex MUGED_Complex::operator+(const MUGED_Complex & scalar)
+inline MUGED_Complex MUGED_Complex::operator+(const MUGED_Complex & scalar) noexcept
 {
-	MUGED_Complex complex;
-	complex.real = (this->real) + scalar.real;
-	complex.imaginary = (this->imaginary) + scalar.imaginary;
-
-	return complex;
+	return MUGED_Complex(this->real + scalar.real, this->imaginary + scalar.imaginary);
 }
 
-inline MUGED_Complex operator+(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2)
+constexpr MUGED_Complex operator+(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2) noexcept
 {
-	MUGED_Complex complex;
-	complex.real = scalar1.real + scalar2.real;
-	complex.imaginary = scalar1.imaginary + scalar2.imaginary;
-
-	return complex;
+	return MUGED_Complex(scalar1.real + scalar2.real, scalar1.imaginary + scalar2.imaginary, MUGED_Complex::muged_cartesian());
 }
 
-inline void MUGED_Complex::operator+=(const MUGED_Complex & scalar)
+inline void MUGED_Complex::operator+=(const MUGED_Complex & scalar) noexcept
 {
 	this->real += scalar.real;
 	this->imaginary += scalar.imaginary;
 }
 
-inline MUGED_Complex MUGED_Complex::operator-(const MUGED_Complex & scalar)
+inline MUGED_Complex MUGED_Complex::operator-(const MUGED_Complex & scalar) noexcept
 {
-	MUGED_Complex reverse_scalar = MUGED_Complex(-scalar.real, -scalar.imaginary);
-	return (*this) + reverse_scalar;
+	return MUGED_Complex(this->real - scalar.real, this->imaginary - scalar.imaginary);
 }
 
-inline MUGED_Complex operator-(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2)
+constexpr MUGED_Complex operator-(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2) noexcept
 {
-	MUGED_Complex reverse_scalar2 = MUGED_Complex(-scalar2.real, -scalar2.imaginary);
-	return scalar1 + reverse_scalar2;
+	return MUGED_Complex(scalar1.real - scalar2.real, scalar1.imaginary - scalar2.imaginary, MUGED_Complex::muged_cartesian());
 }
 
-inline void MUGED_Complex::operator-=(const MUGED_Complex & scalar)
+inline void MUGED_Complex::operator-=(const MUGED_Complex & scalar) noexcept
 {
-	MUGED_Complex reverse_scalar = MUGED_Complex(-scalar.real, -scalar.imaginary);
-	(*this) += reverse_scalar;
+	this->real -= scalar.real;
+	this->imaginary -= scalar.imaginary;
 }
 
-inline MUGED_Complex MUGED_Complex::operator*(MUGED_Complex & scalar)
+inline MUGED_Complex MUGED_Complex::operator*(MUGED_Complex & scalar) noexcept
 {
-	double abs1 = this->muged_abs();
-	double angle1 = this->muged_angle();
-
-	double abs2 = scalar.muged_abs();
-	double angle2 = scalar.muged_angle();
-
-	MUGED_Complex complex;
-	complex.real = abs1*abs2*cos(angle1 + angle2);
-	complex.imaginary = abs1*abs2*sin(angle1 + angle2);
-
-	return complex;
+	//(a + bi)(c + di) = (ac - bd) + (ad + bc)i
+	return MUGED_Complex(this->real * scalar.real - this->imaginary * scalar.imaginary,
+	                     this->real * scalar.imaginary + this->imaginary * scalar.real);
 }
 
-inline MUGED_Complex operator*(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2)
+constexpr MUGED_Complex operator*(const MUGED_Complex & scalar1, const MUGED_Complex & scalar2) noexcept
 {
-	double abs1 = scalar1.muged_abs();
-	double angle1 = scalar1.muged_angle();
-
-	double abs2 = scalar2.muged_abs();
-	double angle2 = scalar2.muged_angle();
-
-	MUGED_Complex complex;
-	complex.real = abs1*abs2*cos(angle1 + angle2);
-	complex.imaginary = abs1*abs2*sin(angle1 + angle2);
-
-	return complex;
+	return MUGED_Complex(scalar1.real * scalar2.real - scalar1.imaginary * scalar2.imaginary,
+	                     scalar1.real * scalar2.imaginary + scalar1.imaginary * scalar2.real, MUGED_Complex::muged_cartesian());
 }
 
-inline MUGED_Complex MUGED_Complex::operator/(double value)
+inline MUGED_Complex MUGED_Complex::operator/(double value) noexcept
 {
-	MUGED_Complex complex;
-
-	complex.real = (this->real)/value;
-	complex.imaginary = (this->imaginary)/value;
-
-	return complex;
+	return MUGED_Complex(this->real / value, this->imaginary / value);
 }
 
-inline void MUGED_Complex::operator/=(double value)
+inline void MUGED_Complex::operator/=(double value) noexcept
 {
 	this->real/=value;
 	this->imaginary/=value;
 }
 
-inline MUGED_Complex MUGED_Complex::operator/(MUGED_Complex& scalar)
+inline MUGED_Complex MUGED_Complex::operator/(MUGED_Complex& scalar) noexcept
 {
-	MUGED_Complex complex;
-	complex.real = this->real * scalar.real + this->imaginary * scalar.imaginary;
-	complex.imaginary = this->imaginary * scalar.real - this->real * scalar.imaginary;
-
-	complex /= (pow(scalar.real,2) + pow(scalar.imaginary,2));
+	double norm = scalar.real * scalar.real + scalar.imaginary * scalar.imaginary;
 
-	return complex;
+	return MUGED_Complex((this->real * scalar.real + this->imaginary * scalar.imaginary) / norm,
+	                     (this->imaginary * scalar.real - this->real * scalar.imaginary) / norm);
 }
 
-inline void MUGED_Complex::operator/=(MUGED_Complex& scalar)
+inline void MUGED_Complex::operator/=(MUGED_Complex& scalar) noexcept
 {
-	MUGED_Complex complex;
-	complex.real = this->real * scalar.real + this->imaginary * scalar.imaginary;
-	complex.imaginary = this->imaginary * scalar.real - this->real * scalar.imaginary;
-
-	complex /= (pow(scalar.real,2) + pow(scalar.imaginary,2));
-
-	this->real = complex.real;
-	this->imaginary = complex.imaginary;
+	(*this) = (*this) / scalar;
 }
 
-inline MUGED_Complex MUGED_Complex::muged_pow(double exp)
+inline MUGED_Complex MUGED_Complex::muged_pow(double exp) noexcept
 {
+	if (exp == floor(exp) && fabs(exp) <= MUGED_COMPLEX_INTEGER_POWER)
+	{
+		//Square-and-multiply on bits of exponent
+		unsigned int bits = (unsigned int)fabs(exp);
+		MUGED_Complex base = (*this);
+		MUGED_Complex complex(1, 0);
+
+		while (bits)
+		{
+			if (bits & 1)
+				complex = complex * base;
+
+			bits >>= 1;
+			if (bits)
+				base = base * base;
+		}
+
+		//z^-n = conj(z^n) / |z^n|^2
+		if (exp < 0)
+		{
+			double norm = complex.real * complex.real + complex.imaginary * complex.imaginary;
+			complex = MUGED_Complex(complex.real / norm, -complex.imaginary / norm);
+		}
+
+		return complex;
+	}
+
 	double abs = muged_abs();
 	double angle = muged_angle();
 
@@ -433,8 +390,26 @@ inline MUGED_Complex MUGED_Complex::muged_pow(double exp)
 	return complex;
 }
 
-inline MUGED_Complex MUGED_Complex::muged_sqrt(double exp)
+inline MUGED_Complex MUGED_Complex::muged_sqrt(double exp) noexcept
 {
+	if (exp == 2)
+	{
+		//sqrt(a + bi) = sqrt((|z| + a)/2) + sign(b)*sqrt((|z| - a)/2)i, computed
+		//from the larger part so that cancellation doesn't lose precision
+		double abs = muged_abs();
+		if (abs == 0)
+			return MUGED_Complex();
+
+		if (this->real >= 0)
+		{
+			double root = sqrt((abs + this->real) / 2);
+			return MUGED_Complex(root, this->imaginary / (2 * root));
+		}
+
+		double root = sqrt((abs - this->real) / 2);
+		return MUGED_Complex(fabs(this->imaginary) / (2 * root), signbit(this->imaginary) ? -root : root);
+	}
+
 	double abs = muged_abs();
 	double angle = muged_angle();
 
@@ -445,5 +420,66 @@ inline MUGED_Complex MUGED_Complex::muged_sqrt(double exp)
 	return complex;
 }
 
-#endif /* _MUGED_COMPLEX_H_ */
+//Arrays are copied with memcpy and shared with numeric code using std::complex<double> or double[2]
+static_assert(std::is_trivially_copyable<MUGED_Complex>::value, "MUGED_Complex has to be trivially copyable");
+static_assert(std::is_standard_layout<MUGED_Complex>::value, "MUGED_Complex has to be standard layout");
+static_assert(sizeof(MUGED_Complex) == sizeof(std::complex<double>) && sizeof(MUGED_Complex) == 2 * sizeof(double),
+              "MUGED_Complex has to have layout of std::complex<double>");
+static_assert(alignof(MUGED_Complex) == alignof(std::complex<double>),
+              "MUGED_Complex has to have alignment of std::complex<double>");
+
+/**
+ * @fn muged_as_std_complex(MUGED_Complex* array)
+ *
+ * Reinterprets array of complex values without copying
+ *
+ * @param array - complex values
+ * @return std::complex<double>* - the same values as std::complex<double>
+ */
+inline std::complex<double>* muged_as_std_complex(MUGED_Complex* array) noexcept
+{
+	return reinterpret_cast<std::complex<double>*>(array);
+}
 
+inline const std::complex<double>* muged_as_std_complex(const MUGED_Complex* array) noexcept
+{
+	return reinterpret_cast<const std::complex<double>*>(array);
+}
+
+/**
+ * @fn muged_from_std_complex(std::complex<double>* array)
+ *
+ * Reinterprets array of std::complex<double> without copying
+ *
+ * @param array - std::complex<double> values
+ * @return MUGED_Complex* - the same values as MUGED_Complex
+ */
+inline MUGED_Complex* muged_from_std_complex(std::complex<double>* array) noexcept
+{
+	return reinterpret_cast<MUGED_Complex*>(array);
+}
+
+inline const MUGED_Complex* muged_from_std_complex(const std::complex<double>* array) noexcept
+{
+	return reinterpret_cast<const MUGED_Complex*>(array);
+}
+
+/**
+ * @fn muged_as_doubles(MUGED_Complex* array)
+ *
+ * Reinterprets array of complex values as interleaved doubles without copying
+ *
+ * @param array - n complex values
+ * @return double* - 2n doubles, real and imaginary part of every value
+ */
+inline double* muged_as_doubles(MUGED_Complex* array) noexcept
+{
+	return reinterpret_cast<double*>(array);
+}
+
+inline const double* muged_as_doubles(const MUGED_Complex* array) noexcept
+{
+	return reinterpret_cast<const double*>(array);
+}
+
+#endif /* _MUGED_COMPLEX_H_ */
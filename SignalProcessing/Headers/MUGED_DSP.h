@@ -11,6 +11,15 @@
 
 #include "MUGED_Definitions.h"
 #include "MUGED_Types.h"
+#include "MUGED_FFTPlan.h"
+#include "MUGED_FFTPlanCache.h"
+#include "MUGED_Memory.h"
+#include "MUGED_Array.h"
+#include "MUGED_Arena.h"
+#include "MUGED_SampleView.h"
+#include "MUGED_Accumulator.h"
+#include "MUGED_MovingStatistics.h"
+#include "MUGED_Sketch.h"
 #include "_MUGED_DSP_.h"
 
 /**
@@ -27,9 +36,36 @@
  * - root mean square
  * - standard deviation
  * - Kalman filter (not yet)
- * - Fast Fourier transform
+ * - Fast Fourier transform (any length, without zero padding)
+ * - 2D Fast Fourier transform (row-column decomposition), also of strided matrix views
  *
- * This class supports complex values.
+ * Transforms and correlation are also available as overloads returning owning
+ * MUGED_Array / MUGED_Matrix results by value (moved, never copied), which free
+ * their memory themselves.
+ *
+ * Methods with _into suffix write results into buffers supplied by caller and
+ * allocate nothing for them. Length of supplied array is its capacity, it has to
+ * be at least the result length (ERR_ARRAY_LENGTH is thrown otherwise), result
+ * occupies its first samples and the number of them is returned. Methods with
+ * _in_place suffix overwrite their input.
+ *
+ * Statistics, correlation and FFT accept also MUGED_SampleView, which wraps
+ * samples of caller in other formats (real double, float or int16 I/Q pairs)
+ * without copying them.
+ *
+ * Statistics of streams which don't fit in memory are kept by MUGED_Accumulator,
+ * statistics of sliding window by MUGED_MovingStatistics, quantiles and histogram
+ * of amplitude by MUGED_QuantileSketch and MUGED_Histogram.
+ *
+ * Temporary buffers are taken from scratch arena of the calling thread (muged_scratch()),
+ * which grows to the largest need and is reused by next calls, so repeated calls
+ * of the same size allocate no temporary memory from heap. Object itself holds no
+ * state, it can be copied and shared by many threads.
+ *
+ * This class supports complex values. FFT, statistics and correlation are
+ * available also for split-complex arrays (muged_split_array), which keep real
+ * and imaginary parts in separate aligned arrays and may skip imaginary part
+ * of real signals.
  * @see MUGED_Complex
  */
 class MUGED_DSP : public _MUGED_DSP_
@@ -82,7 +118,7 @@ public:
 	 * @fn muged_1D_fft(muged_array& signal, muged_array& spectrum)
 	 * @see _MUGED_DSP_::muged_1D_fft(muged_array& signal, muged_array& spectrum)
 	 *
-	 * Calculates 1D Fast Fourier Transform
+	 * Calculates 1D Fast Fourier Transform. Plan is taken from muged_plan_cache().
 	 *
 	 * @param signal - 1D signal
 	 * @param spectrum - result (memory will be allocated)
@@ -93,7 +129,7 @@ public:
 	 * @fn muged_1D_ifft(muged_array& spectrum, muged_array& signal)
 	 * @see _MUGED_DSP_::muged_1D_ifft(muged_array& spectrum, muged_array& signal)
 	 *
-	 * Calculates 1D Inverse Fast Fourier Transform
+	 * Calculates 1D Inverse Fast Fourier Transform. Plan is taken from muged_plan_cache().
 	 *
 	 * @param spectrum - 1D signal spectrum
 	 * @param signal - result, signal in time domain (memory will be allocated)
@@ -101,14 +137,121 @@ public:
 	void muged_1D_ifft(muged_array& spectrum, muged_array& signal);
 
 	/**
-	 * @fn muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
-	 * @see _MUGED_DSP_::muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
+	 * @fn muged_1D_rfft(muged_real_array& signal, muged_array& spectrum)
+	 * @see _MUGED_DSP_::muged_1D_rfft(muged_real_array& signal, muged_array& spectrum)
 	 *
-	 * Calculates 2D Fast Fourier Transform
+	 * Calculates 1D Fast Fourier Transform of real signal. Even length signal
+	 * is calculated with half length complex transform.
+	 *
+	 * @param signal - 1D real signal
+	 * @param spectrum - result, signal.length/2+1 spectrum bins (memory will be allocated)
+	 */
+	void muged_1D_rfft(muged_real_array& signal, muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal)
+	 * @see _MUGED_DSP_::muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of real signal spectrum
+	 *
+	 * @param spectrum - length/2+1 spectrum bins
+	 * @param length - number of signal samples
+	 * @param signal - result, real signal in time domain (memory will be allocated)
+	 */
+	void muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal);
+
+	/**
+	 * @fn muged_1D_fft_batch(muged_array& signals, size_t length, size_t count, size_t stride, size_t distance, muged_array& spectra)
+	 * @see _MUGED_DSP_::muged_1D_fft_batch(muged_array& signals, size_t length, size_t count, size_t stride, size_t distance, muged_array& spectra)
+	 *
+	 * Calculates 1D Fast Fourier Transform of many signals of the same length.
+	 * Sample n of signal k is signals.array[k*distance + n*stride].
+	 * All transforms share one plan taken from muged_plan_cache().
+	 *
+	 * @param signals - 1D signals
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @param spectra - result, spectrum k starts at k*length (memory will be allocated)
+	 */
+	void muged_1D_fft_batch(muged_array& signals, size_t length, size_t count,
+	                        size_t stride, size_t distance, muged_array& spectra);
+
+	/**
+	 * @fn muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count, size_t stride, size_t distance, muged_array& signals)
+	 * @see _MUGED_DSP_::muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count, size_t stride, size_t distance, muged_array& signals)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of many spectra of the same length.
+	 * Bin n of spectrum k is spectra.array[k*distance + n*stride].
+	 *
+	 * @param spectra - 1D signal spectra
+	 * @param length - length of each spectrum
+	 * @param count - number of spectra
+	 * @param stride - distance between bins of one spectrum
+	 * @param distance - distance between first bins of consecutive spectra
+	 * @param signals - result, signal k starts at k*length (memory will be allocated)
+	 */
+	void muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count,
+	                         size_t stride, size_t distance, muged_array& signals);
+
+	/**
+	 * @fn muged_1D_fft(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Fast Fourier Transform using precomputed plan.
+	 * Signal is zero padded or truncated to the plan length.
 	 *
 	 * @param signal - 1D signal
 	 * @param spectrum - result (memory will be allocated)
-	 * @attention Not implemented yet!
+	 * @param plan - forward FFT plan
+	 */
+	void muged_1D_fft(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_ifft(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform using precomputed plan
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param signal - result, signal in time domain (memory will be allocated)
+	 * @param plan - inverse FFT plan
+	 */
+	void muged_1D_ifft(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_plan_cache()
+	 *
+	 * Returns cache of plans used by muged_1D_fft and muged_1D_ifft.
+	 * The cache is shared by all MUGED_DSP objects and threads. It holds
+	 * at most MUGED_FFT_CACHE_PLANS plans and MUGED_FFT_CACHE_BYTES bytes and
+	 * doesn't evict them, plans of further lengths are built on every call.
+	 *
+	 * @return MUGED_FFTPlanCache& - plan cache
+	 */
+	static MUGED_FFTPlanCache& muged_plan_cache();
+
+	/**
+	 * @fn muged_scratch()
+	 *
+	 * Returns arena of temporary buffers of the calling thread, e.g. to read
+	 * its peak use or to reserve memory up front with MUGED_Arena::muged_reserve.
+	 * All MUGED_DSP objects used by the thread share it.
+	 *
+	 * @return MUGED_Arena& - scratch arena
+	 */
+	static MUGED_Arena& muged_scratch();
+
+	/**
+	 * @fn muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
+	 * @see _MUGED_DSP_::muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
+	 *
+	 * Calculates 2D Fast Fourier Transform. Transforms of rows, blocked transpose
+	 * and transforms of columns, rows and columns are spread across threads.
+	 * Plans are taken from muged_plan_cache().
+	 *
+	 * @param signal - 2D signal
+	 * @param spectrum - result (memory will be allocated, rows are stored in one
+	 *                   block: delete [] spectrum.matrix[0], then delete [] spectrum.matrix)
 	 */
 	void muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum);
 
@@ -119,10 +262,397 @@ public:
 	 * Calculates 2D Inverse Fast Fourier Transform
 	 *
 	 * @param spectrum - 2D signal spectrum
-	 * @param signal - result, signal in "time" domain (memory will be allocated)
+	 * @param signal - result, signal in "time" domain (memory will be allocated
+	 *                 the same way as by muged_2D_fft)
 	 */
 	void muged_2D_ifft(muged_matrix& spectrum, muged_matrix& signal);
 
+	/**
+	 * @fn muged_1D_correlation(muged_array& fsignal, muged_array& ssignal, size_t min_lag, size_t max_lag)
+	 *
+	 * Calculates 1D correlation the same way as muged_1D_correlation with result parameter
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @return MUGED_Array - result
+	 */
+	MUGED_Array muged_1D_correlation(muged_array& fsignal, muged_array& ssignal,
+	                                 size_t min_lag, size_t max_lag);
+
+	/**
+	 * @fn muged_1D_fft(muged_array& signal)
+	 *
+	 * Calculates 1D Fast Fourier Transform. Plan is taken from muged_plan_cache().
+	 *
+	 * @param signal - 1D signal
+	 * @return MUGED_Array - spectrum
+	 */
+	MUGED_Array muged_1D_fft(muged_array& signal);
+
+	/**
+	 * @fn muged_1D_ifft(muged_array& spectrum)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform. Plan is taken from muged_plan_cache().
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @return MUGED_Array - signal in time domain
+	 */
+	MUGED_Array muged_1D_ifft(muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_fft(muged_array& signal, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Fast Fourier Transform using precomputed plan.
+	 * Signal is zero padded or truncated to the plan length.
+	 *
+	 * @param signal - 1D signal
+	 * @param plan - forward FFT plan
+	 * @return MUGED_Array - spectrum
+	 */
+	MUGED_Array muged_1D_fft(muged_array& signal, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_ifft(muged_array& spectrum, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform using precomputed plan
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param plan - inverse FFT plan
+	 * @return MUGED_Array - signal in time domain
+	 */
+	MUGED_Array muged_1D_ifft(muged_array& spectrum, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_rfft(muged_real_array& signal)
+	 *
+	 * Calculates 1D Fast Fourier Transform of real signal
+	 *
+	 * @param signal - 1D real signal
+	 * @return MUGED_Array - signal.length/2+1 spectrum bins
+	 */
+	MUGED_Array muged_1D_rfft(muged_real_array& signal);
+
+	/**
+	 * @fn muged_1D_irfft(muged_array& spectrum, size_t length)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of real signal spectrum
+	 *
+	 * @param spectrum - length/2+1 spectrum bins
+	 * @param length - number of signal samples
+	 * @return MUGED_RealArray - real signal in time domain
+	 */
+	MUGED_RealArray muged_1D_irfft(muged_array& spectrum, size_t length);
+
+	/**
+	 * @fn muged_1D_fft_batch(muged_array& signals, size_t length, size_t count, size_t stride, size_t distance)
+	 *
+	 * Calculates 1D Fast Fourier Transform of many signals of the same length
+	 *
+	 * @param signals - 1D signals, sample n of signal k is signals.array[k*distance + n*stride]
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @return MUGED_Array - spectra, spectrum k starts at k*length
+	 */
+	MUGED_Array muged_1D_fft_batch(muged_array& signals, size_t length, size_t count,
+	                               size_t stride, size_t distance);
+
+	/**
+	 * @fn muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count, size_t stride, size_t distance)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of many spectra of the same length
+	 *
+	 * @param spectra - 1D signal spectra, bin n of spectrum k is spectra.array[k*distance + n*stride]
+	 * @param length - length of each spectrum
+	 * @param count - number of spectra
+	 * @param stride - distance between bins of one spectrum
+	 * @param distance - distance between first bins of consecutive spectra
+	 * @return MUGED_Array - signals, signal k starts at k*length
+	 */
+	MUGED_Array muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count,
+	                                size_t stride, size_t distance);
+
+	/**
+	 * @fn muged_2D_fft(muged_matrix& signal)
+	 *
+	 * Calculates 2D Fast Fourier Transform
+	 *
+	 * @param signal - 2D signal
+	 * @return MUGED_Matrix - spectrum
+	 */
+	MUGED_Matrix muged_2D_fft(muged_matrix& signal);
+
+	/**
+	 * @fn muged_2D_ifft(muged_matrix& spectrum)
+	 *
+	 * Calculates 2D Inverse Fast Fourier Transform
+	 *
+	 * @param spectrum - 2D signal spectrum
+	 * @return MUGED_Matrix - signal in "time" domain
+	 */
+	MUGED_Matrix muged_2D_ifft(muged_matrix& spectrum);
+
+	/**
+	 * @fn muged_2D_fft(const MUGED_MatrixView& signal)
+	 *
+	 * Calculates 2D Fast Fourier Transform of strided view, e.g. tile of larger matrix
+	 *
+	 * @param signal - 2D signal
+	 * @return MUGED_Matrix - spectrum
+	 */
+	MUGED_Matrix muged_2D_fft(const MUGED_MatrixView& signal);
+
+	/**
+	 * @fn muged_2D_ifft(const MUGED_MatrixView& spectrum)
+	 *
+	 * Calculates 2D Inverse Fast Fourier Transform of strided view
+	 *
+	 * @param spectrum - 2D signal spectrum
+	 * @return MUGED_Matrix - signal in "time" domain
+	 */
+	MUGED_Matrix muged_2D_ifft(const MUGED_MatrixView& spectrum);
+
+	/**
+	 * @fn muged_1D_correlation_into(muged_array& fsignal, muged_array& ssignal, size_t min_lag, size_t max_lag, muged_array& correlation)
+	 *
+	 * Calculates 1D correlation into caller buffer
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result, at least 2*max_lag+1 samples
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_correlation_into(muged_array& fsignal, muged_array& ssignal,
+	                                 size_t min_lag, size_t max_lag,
+	                                 muged_array& correlation);
+
+	/**
+	 * @fn muged_1D_fft_into(muged_array& signal, muged_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform into caller buffer. Plan is taken from muged_plan_cache().
+	 *
+	 * @param signal - 1D signal
+	 * @param spectrum - result, at least signal.length samples (may be signal)
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_fft_into(muged_array& signal, muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_ifft_into(muged_array& spectrum, muged_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform into caller buffer
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param signal - result, at least spectrum.length samples (may be spectrum)
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_ifft_into(muged_array& spectrum, muged_array& signal);
+
+	/**
+	 * @fn muged_1D_fft_into(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Fast Fourier Transform using precomputed plan into caller buffer
+	 *
+	 * @param signal - 1D signal, zero padded or truncated to the plan length
+	 * @param spectrum - result, at least plan.muged_length() samples
+	 * @param plan - forward FFT plan
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_fft_into(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_ifft_into(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform using precomputed plan into caller buffer
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param signal - result, at least plan.muged_length() samples
+	 * @param plan - inverse FFT plan
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_ifft_into(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_fft_in_place(muged_array& signal)
+	 *
+	 * Replaces signal with its spectrum. Plan is taken from muged_plan_cache().
+	 *
+	 * @param signal - 1D signal
+	 */
+	void muged_1D_fft_in_place(muged_array& signal);
+
+	/**
+	 * @fn muged_1D_ifft_in_place(muged_array& spectrum)
+	 *
+	 * Replaces spectrum with signal in time domain
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 */
+	void muged_1D_ifft_in_place(muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_fft_in_place(muged_array& signal, MUGED_FFTPlan& plan)
+	 *
+	 * Replaces signal with its spectrum using precomputed plan
+	 *
+	 * @param signal - 1D signal, plan.muged_length() samples (ERR_FFT_LENGTH is thrown otherwise)
+	 * @param plan - forward FFT plan
+	 */
+	void muged_1D_fft_in_place(muged_array& signal, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_ifft_in_place(muged_array& spectrum, MUGED_FFTPlan& plan)
+	 *
+	 * Replaces spectrum with signal in time domain using precomputed plan
+	 *
+	 * @param spectrum - 1D signal spectrum, plan.muged_length() samples (ERR_FFT_LENGTH is thrown otherwise)
+	 * @param plan - inverse FFT plan
+	 */
+	void muged_1D_ifft_in_place(muged_array& spectrum, MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_1D_rfft_into(muged_real_array& signal, muged_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform of real signal into caller buffer
+	 *
+	 * @param signal - 1D real signal
+	 * @param spectrum - result, at least signal.length/2+1 spectrum bins
+	 * @return size_t - number of result bins
+	 */
+	size_t muged_1D_rfft_into(muged_real_array& signal, muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_irfft_into(muged_array& spectrum, size_t length, muged_real_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of real signal spectrum into caller buffer
+	 *
+	 * @param spectrum - length/2+1 spectrum bins
+	 * @param length - number of signal samples
+	 * @param signal - result, at least length samples
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_irfft_into(muged_array& spectrum, size_t length, muged_real_array& signal);
+
+	/**
+	 * @fn muged_1D_fft_batch_into(muged_array& signals, size_t length, size_t count, size_t stride, size_t distance, muged_array& spectra)
+	 *
+	 * Calculates batch of 1D Fast Fourier Transforms into caller buffer
+	 *
+	 * @param signals - 1D signals, sample n of signal k is signals.array[k*distance + n*stride]
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @param spectra - result, at least count*length samples, spectrum k starts at k*length
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_fft_batch_into(muged_array& signals, size_t length, size_t count,
+	                               size_t stride, size_t distance, muged_array& spectra);
+
+	/**
+	 * @fn muged_1D_ifft_batch_into(muged_array& spectra, size_t length, size_t count, size_t stride, size_t distance, muged_array& signals)
+	 *
+	 * Calculates batch of 1D Inverse Fast Fourier Transforms into caller buffer
+	 *
+	 * @param spectra - 1D signal spectra, bin n of spectrum k is spectra.array[k*distance + n*stride]
+	 * @param length - length of each spectrum
+	 * @param count - number of spectra
+	 * @param stride - distance between bins of one spectrum
+	 * @param distance - distance between first bins of consecutive spectra
+	 * @param signals - result, at least count*length samples, signal k starts at k*length
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_ifft_batch_into(muged_array& spectra, size_t length, size_t count,
+	                                size_t stride, size_t distance, muged_array& signals);
+
+	/**
+	 * @fn muged_2D_fft_into(muged_matrix& signal, MUGED_MatrixView spectrum)
+	 *
+	 * Calculates 2D Fast Fourier Transform into caller matrix, e.g. tile of larger one
+	 *
+	 * @param signal - 2D signal
+	 * @param spectrum - result, the same size as signal (ERR_ARRAY_MISMATCH is thrown otherwise)
+	 */
+	void muged_2D_fft_into(muged_matrix& signal, MUGED_MatrixView spectrum);
+
+	/**
+	 * @fn muged_2D_ifft_into(muged_matrix& spectrum, MUGED_MatrixView signal)
+	 *
+	 * Calculates 2D Inverse Fast Fourier Transform into caller matrix
+	 *
+	 * @param spectrum - 2D signal spectrum
+	 * @param signal - result, the same size as spectrum (ERR_ARRAY_MISMATCH is thrown otherwise)
+	 */
+	void muged_2D_ifft_into(muged_matrix& spectrum, MUGED_MatrixView signal);
+
+	/**
+	 * @fn muged_2D_fft_into(const MUGED_MatrixView& signal, MUGED_MatrixView spectrum)
+	 *
+	 * Calculates 2D Fast Fourier Transform of strided view into caller matrix
+	 *
+	 * @param signal - 2D signal
+	 * @param spectrum - result, the same size as signal (ERR_ARRAY_MISMATCH is thrown otherwise)
+	 */
+	void muged_2D_fft_into(const MUGED_MatrixView& signal, MUGED_MatrixView spectrum);
+
+	/**
+	 * @fn muged_2D_ifft_into(const MUGED_MatrixView& spectrum, MUGED_MatrixView signal)
+	 *
+	 * Calculates 2D Inverse Fast Fourier Transform of strided view into caller matrix
+	 *
+	 * @param spectrum - 2D signal spectrum
+	 * @param signal - result, the same size as spectrum (ERR_ARRAY_MISMATCH is thrown otherwise)
+	 */
+	void muged_2D_ifft_into(const MUGED_MatrixView& spectrum, MUGED_MatrixView signal);
+
+	/**
+	 * @fn muged_2D_fft_in_place(MUGED_MatrixView signal)
+	 *
+	 * Replaces 2D signal with its spectrum. Plain matrix with equally spaced rows
+	 * is passed as MUGED_MatrixView(matrix).
+	 *
+	 * @param signal - 2D signal
+	 */
+	void muged_2D_fft_in_place(MUGED_MatrixView signal);
+
+	/**
+	 * @fn muged_2D_ifft_in_place(MUGED_MatrixView spectrum)
+	 *
+	 * Replaces 2D spectrum with signal in "time" domain
+	 *
+	 * @param spectrum - 2D signal spectrum
+	 */
+	void muged_2D_ifft_in_place(MUGED_MatrixView spectrum);
+
+	/**
+	 * @fn muged_signal_statistics(muged_array& signal)
+	 *
+	 * Calculates mean, mean square, RMS, standard deviation and smallest and
+	 * largest magnitude of 1D signal in one vectorized pass. Methods calculating
+	 * one of them use it too. Long signal is summed in chunks by threads and sums
+	 * of chunks are added pairwise (see muged_pairwise_reduce), so error doesn't
+	 * grow with length and result doesn't depend on number of threads.
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_statistics - result
+	 */
+	muged_statistics muged_signal_statistics(muged_array& signal);
+
+	/**
+	 * @fn muged_signal_statistics(const MUGED_SampleView& signal)
+	 *
+	 * Calculates all statistics of 1D signal in any sample format in one pass
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_statistics - result
+	 */
+	muged_statistics muged_signal_statistics(const MUGED_SampleView& signal);
+
 	/**
 	 * @fn muged_mean(muged_array& signal)
 	 * @see _MUGED_DSP_::muged_mean(muged_array& signal, muged_scalar mean)
@@ -167,6 +697,308 @@ public:
 	 */
 	muged_scalar muged_standard_deviation(muged_array& signal);
 
+	/**
+	 * @fn muged_moving_mean(muged_array& signal, size_t window)
+	 *
+	 * Calculates mean of sliding window ending at every sample, O(1) per sample
+	 * (first window-1 results use samples available so far)
+	 *
+	 * @param signal - 1D signal
+	 * @param window - number of samples in window
+	 * @return MUGED_Array - result, signal.length samples
+	 */
+	MUGED_Array muged_moving_mean(muged_array& signal, size_t window);
+
+	/**
+	 * @fn muged_moving_mean_square(muged_array& signal, size_t window)
+	 *
+	 * Calculates mean square of sliding window ending at every sample, O(1) per sample
+	 * (first window-1 results use samples available so far)
+	 *
+	 * @param signal - 1D signal
+	 * @param window - number of samples in window
+	 * @return MUGED_Array - result, signal.length samples
+	 */
+	MUGED_Array muged_moving_mean_square(muged_array& signal, size_t window);
+
+	/**
+	 * @fn muged_moving_root_mean_square(muged_array& signal, size_t window)
+	 *
+	 * Calculates RMS of sliding window ending at every sample, O(1) per sample
+	 * (first window-1 results use samples available so far)
+	 *
+	 * @param signal - 1D signal
+	 * @param window - number of samples in window
+	 * @return MUGED_Array - result, signal.length samples
+	 */
+	MUGED_Array muged_moving_root_mean_square(muged_array& signal, size_t window);
+
+	/**
+	 * @fn muged_moving_standard_deviation(muged_array& signal, size_t window)
+	 *
+	 * Calculates standard deviation of sliding window ending at every sample, O(1) per sample
+	 * (first window-1 results use samples available so far)
+	 *
+	 * @param signal - 1D signal
+	 * @param window - number of samples in window
+	 * @return MUGED_Array - result, signal.length samples
+	 */
+	MUGED_Array muged_moving_standard_deviation(muged_array& signal, size_t window);
+
+	/**
+	 * @fn muged_mean(const MUGED_SampleView& signal)
+	 *
+	 * Calculates mean of 1D signal in any sample format, samples are converted while read
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_mean(const MUGED_SampleView& signal);
+
+	/**
+	 * @fn muged_root_mean_square(const MUGED_SampleView& signal)
+	 *
+	 * Calculates RMS of 1D signal in any sample format
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_root_mean_square(const MUGED_SampleView& signal);
+
+	/**
+	 * @fn muged_mean_square(const MUGED_SampleView& signal)
+	 *
+	 * Calculates mean square of 1D signal in any sample format
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_mean_square(const MUGED_SampleView& signal);
+
+	/**
+	 * @fn muged_standard_deviation(const MUGED_SampleView& signal)
+	 *
+	 * Calculates standard deviation of 1D signal in any sample format
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_standard_deviation(const MUGED_SampleView& signal);
+
+	/**
+	 * @fn muged_1D_fft(const MUGED_SampleView& signal)
+	 *
+	 * Calculates 1D Fast Fourier Transform of signal in any sample format. Real
+	 * samples are transformed by real FFT without copy, other formats are
+	 * converted into the spectrum and transformed in place.
+	 *
+	 * @param signal - 1D signal
+	 * @return MUGED_Array - full spectrum, signal.muged_length() bins
+	 */
+	MUGED_Array muged_1D_fft(const MUGED_SampleView& signal);
+
+	/**
+	 * @fn muged_1D_fft_into(const MUGED_SampleView& signal, muged_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform of signal in any sample format into caller buffer
+	 *
+	 * @param signal - 1D signal
+	 * @param spectrum - result, at least signal.muged_length() bins
+	 * @return size_t - number of result bins
+	 */
+	size_t muged_1D_fft_into(const MUGED_SampleView& signal, muged_array& spectrum);
+
+	/**
+	 * @fn muged_1D_correlation(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal, size_t min_lag, size_t max_lag)
+	 *
+	 * Calculates 1D correlation of signals in any sample format, each signal is
+	 * converted once into scratch buffer
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @return MUGED_Array - result
+	 */
+	MUGED_Array muged_1D_correlation(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal,
+	                                 size_t min_lag, size_t max_lag);
+
+	/**
+	 * @fn muged_1D_correlation_into(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal, size_t min_lag, size_t max_lag, muged_array& correlation)
+	 *
+	 * Calculates 1D correlation of signals in any sample format into caller buffer
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result, at least 2*max_lag+1 samples
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_correlation_into(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal,
+	                                 size_t min_lag, size_t max_lag,
+	                                 muged_array& correlation);
+
+	/**
+	 * @fn muged_to_split(muged_array& signal, muged_split_array& split)
+	 *
+	 * Converts complex samples to split-complex array
+	 *
+	 * @param signal - complex samples
+	 * @param split - result (memory will be allocated with muged_split_allocate)
+	 */
+	void muged_to_split(muged_array& signal, muged_split_array& split);
+
+	/**
+	 * @fn muged_from_split(muged_split_array& split, muged_array& signal)
+	 *
+	 * Converts split-complex array to complex samples
+	 *
+	 * @param split - split-complex samples (imag may be NULL)
+	 * @param signal - result (memory will be allocated)
+	 */
+	void muged_from_split(muged_split_array& split, muged_array& signal);
+
+	/**
+	 * @fn muged_1D_fft(muged_split_array& signal, muged_split_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform of split-complex signal. Real signal
+	 * (imag is NULL) is calculated with real transform.
+	 *
+	 * @param signal - 1D signal
+	 * @param spectrum - result, full spectrum (memory will be allocated with muged_split_allocate)
+	 */
+	void muged_1D_fft(muged_split_array& signal, muged_split_array& spectrum);
+
+	/**
+	 * @fn muged_1D_ifft(muged_split_array& spectrum, muged_split_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of split-complex spectrum
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param signal - result (memory will be allocated with muged_split_allocate)
+	 */
+	void muged_1D_ifft(muged_split_array& spectrum, muged_split_array& signal);
+
+	/**
+	 * @fn muged_to_split_into(muged_array& signal, muged_split_array& split)
+	 *
+	 * Converts complex samples into caller split-complex array
+	 *
+	 * @param signal - complex samples
+	 * @param split - result, at least signal.length samples with imaginary part
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_to_split_into(muged_array& signal, muged_split_array& split);
+
+	/**
+	 * @fn muged_from_split_into(muged_split_array& split, muged_array& signal)
+	 *
+	 * Converts split-complex array into caller complex array
+	 *
+	 * @param split - split-complex samples (imag may be NULL)
+	 * @param signal - result, at least split.length samples
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_from_split_into(muged_split_array& split, muged_array& signal);
+
+	/**
+	 * @fn muged_1D_fft_into(muged_split_array& signal, muged_split_array& spectrum)
+	 *
+	 * Calculates 1D Fast Fourier Transform of split-complex signal into caller array
+	 *
+	 * @param signal - 1D signal (imag may be NULL)
+	 * @param spectrum - result, at least signal.length samples with imaginary part
+	 *                   (may be signal if it has imaginary part)
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_fft_into(muged_split_array& signal, muged_split_array& spectrum);
+
+	/**
+	 * @fn muged_1D_ifft_into(muged_split_array& spectrum, muged_split_array& signal)
+	 *
+	 * Calculates 1D Inverse Fast Fourier Transform of split-complex spectrum into caller array
+	 *
+	 * @param spectrum - 1D signal spectrum
+	 * @param signal - result, at least spectrum.length samples with imaginary part (may be spectrum)
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_ifft_into(muged_split_array& spectrum, muged_split_array& signal);
+
+	/**
+	 * @fn muged_mean(muged_split_array& signal)
+	 *
+	 * Calculates mean of split-complex 1D signal
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_mean(muged_split_array& signal);
+
+	/**
+	 * @fn muged_root_mean_square(muged_split_array& signal)
+	 *
+	 * Calculates RMS of split-complex 1D signal
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_root_mean_square(muged_split_array& signal);
+
+	/**
+	 * @fn muged_mean_square(muged_split_array& signal)
+	 *
+	 * Calculates mean square of split-complex 1D signal
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_mean_square(muged_split_array& signal);
+
+	/**
+	 * @fn muged_standard_deviation(muged_split_array& signal)
+	 *
+	 * Calculates standard deviation of split-complex 1D signal
+	 *
+	 * @param signal - 1D signal
+	 * @return muged_scalar - result
+	 */
+	muged_scalar muged_standard_deviation(muged_split_array& signal);
+
+	/**
+	 * @fn muged_1D_correlation(muged_split_array& fsignal, muged_split_array& ssignal, size_t min_lag, size_t max_lag, muged_split_array& correlation)
+	 *
+	 * Calculates 1D correlation of split-complex signals in the same lags as
+	 * muged_1D_correlation of complex arrays. Every lag is a few dot products.
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result (memory will be allocated with muged_split_allocate,
+	 *                      imag is NULL if both signals are real)
+	 */
+	void muged_1D_correlation(muged_split_array& fsignal, muged_split_array& ssignal,
+	                          size_t min_lag, size_t max_lag,
+	                          muged_split_array& correlation);
+
+	/**
+	 * @fn muged_1D_correlation_into(muged_split_array& fsignal, muged_split_array& ssignal, size_t min_lag, size_t max_lag, muged_split_array& correlation)
+	 *
+	 * Calculates 1D correlation of split-complex signals into caller array
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result, at least 2*max_lag+1 samples, imaginary part is required
+	 *                      if any signal is complex (zeros are written to it otherwise)
+	 * @return size_t - number of result samples
+	 */
+	size_t muged_1D_correlation_into(muged_split_array& fsignal, muged_split_array& ssignal,
+	                                 size_t min_lag, size_t max_lag,
+	                                 muged_split_array& correlation);
+
 	/**
 	 * @fn muged_kalman(muged_array& signal, muged_array& filtered_signal)
 	 * @see _MUGED_DSP_::muged_kalman(muged_array& signal, muged_array& filtered_signal)
@@ -181,67 +1013,171 @@ public:
 protected:
 
 	/**
-	 * @fn muged_initialize_fft(muged_array& signal, muged_array& radix_2_signal, muged_array& spectrum)
+	 * @fn muged_initialize_fft(const MUGED_FFTPlan& plan, muged_array& spectrum)
 	 *
-	 * Appends zeros to the signal to provide divisibility by power of two and initialize spectrum
+	 * Allocates result of transform executed with plan
 	 *
-	 * @param signal - input signal
-	 * @param radix_2_signal - zero padded signal
-	 * @param spectrum - spectrum
-	 * @param W - wages for each twiddle factors
-	 * @attention This method has not calculated wages for twiddle factors (W) yet
+	 * @param plan - FFT plan
+	 * @param spectrum - result (memory will be allocated)
+	 */
+	void muged_initialize_fft(const MUGED_FFTPlan& plan, muged_array& spectrum);
+
+	/**
+	 * @fn muged_execute_fft(const MUGED_FFTPlan& plan, muged_array& input, muged_array& output)
+	 *
+	 * Executes shared plan with temporary scratch memory, normalizes inverse transform
+	 *
+	 * @param plan - FFT plan
+	 * @param input - input samples
+	 * @param output - result (allocated with muged_initialize_fft)
+	 */
+	void muged_execute_fft(const MUGED_FFTPlan& plan, muged_array& input, muged_array& output);
+
+	/**
+	 * @fn muged_execute_plan(MUGED_FFTPlan& plan, muged_array& input, muged_array& output)
+	 *
+	 * Executes user plan, normalizes inverse transform
+	 *
+	 * @param plan - FFT plan
+	 * @param input - input samples
+	 * @param output - result (plan.muged_length() samples, already allocated)
+	 */
+	void muged_execute_plan(MUGED_FFTPlan& plan, muged_array& input, muged_array& output);
+
+	/**
+	 * @fn muged_execute_rfft(muged_real_array& signal, muged_array& spectrum)
+	 *
+	 * Calculates real transform with cached plan
+	 *
+	 * @param signal - real signal
+	 * @param spectrum - result (signal.length/2+1 bins, already allocated)
+	 */
+	void muged_execute_rfft(muged_real_array& signal, muged_array& spectrum);
+
+	/**
+	 * @fn muged_execute_irfft(muged_array& spectrum, muged_real_array& signal)
+	 *
+	 * Calculates inverse real transform with cached plan and normalizes it
+	 *
+	 * @param spectrum - at least signal.length/2+1 bins
+	 * @param signal - result (already allocated, its length is transform length)
+	 */
+	void muged_execute_irfft(muged_array& spectrum, muged_real_array& signal);
+
+	/**
+	 * @fn muged_execute_correlation(muged_array& fsignal, muged_array& ssignal, size_t min_lag, size_t max_lag, muged_array& correlation)
+	 *
+	 * Calculates 1D correlation
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result (2*max_lag+1 samples, already allocated)
+	 */
+	void muged_execute_correlation(muged_array& fsignal, muged_array& ssignal,
+	                               size_t min_lag, size_t max_lag,
+	                               muged_array& correlation);
+
+	/**
+	 * @fn muged_check_batch(muged_array& input, size_t length, size_t count, size_t stride, size_t distance)
+	 *
+	 * Checks that every sample of batch lies inside input, throws ERR_ARRAY_LENGTH otherwise.
+	 * Empty signals throw ERR_FFT_LENGTH.
+	 *
+	 * @param input - input signals
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
 	 */
-	void muged_initialize_fft(muged_array& signal, muged_array& radix_2_signal, muged_array& spectrum, muged_array& W);
+	void muged_check_batch(muged_array& input, size_t length, size_t count, size_t stride, size_t distance);
 
 	/**
-	 * @fn muged_fft_kernel(muged_array& radix_2_signal)
+	 * @fn muged_batch_fft(muged_array& input, size_t length, size_t count, size_t stride, size_t distance, MUGED_FFTDirection direction, muged_array& output)
 	 *
-	 * FFT kernel - it calculates fft using
-	 * divide and conquer algorithm (Cooley–Tukey)
+	 * Calculates batch of transforms with cached plan, normalizes inverse transform
+	 *
+	 * @param input - input signals (checked with muged_check_batch)
+	 * @param length - length of each signal
+	 * @param count - number of signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @param direction - forward or inverse transform
+	 * @param output - result (count*length samples, already allocated)
+	 */
+	void muged_batch_fft(muged_array& input, size_t length, size_t count, size_t stride, size_t distance,
+	                     MUGED_FFTDirection direction, muged_array& output);
+
+	/**
+	 * @fn muged_initialize_2D(size_t rows, size_t cols, muged_matrix& output)
 	 *
-	 * @param radix_2_signal - time samples
-	 * @return muged_array* - spectrum
+	 * Allocates result of 2D transform, rows share one block
 	 *
-	 * FFT(n, a0, a1, a2, a3, ... , an-1)
-	 * {
-	 * 	if (n == 1) return a0;
-	 * 	w = e^-2πi/n;
-	 * 	(e0, e1, e2, e3,..., en/2-1) = FFT(n/2, a0, a2, a4, a6,..., an-2);
-	 * 	(d0, d1, d2, d3,..., dn/2-1) = FFT(n/2, a1, a3, a5, a7,..., an-1);
-	 * 	for k = 0 to n/2-1
-	 * 	{
-	 * 		y_k = e_k + w^k*d_k;
-	 * 		y_k+n/2 = e_k – w^k*d_k
-	 * 	};
-	 * 	return (y1, y2, y3,..., yn-1);
-	 * }
+	 * @param rows - number of rows, not 0
+	 * @param cols - number of columns, not 0
+	 * @param output - result (memory will be allocated)
 	 */
-	muged_array* muged_fft_kernel(muged_array& radix_2_signal);
+	void muged_initialize_2D(size_t rows, size_t cols, muged_matrix& output);
 
 	/**
-	 * @fn muged_ifft_kernel(muged_array& radix_2_signal)
+	 * @fn muged_2D_transform(muged_scalar* const* input, MUGED_FFTDirection direction, MUGED_MatrixView output)
 	 *
-	 * IFFT kernel - it calculates ifft using
-	 * divide and conquer algorithm (Cooley–Tukey)
+	 * Calculates 2D transform with cached plans, normalizes inverse transform
+	 *
+	 * @param input - rows of 2D signal or spectrum, the same size as output (NULL transforms output in place)
+	 * @param direction - forward or inverse transform
+	 * @param output - result (not empty, already allocated, may be tile of larger matrix)
+	 */
+	void muged_2D_transform(muged_scalar* const* input, MUGED_FFTDirection direction, MUGED_MatrixView output);
+
+	/**
+	 * @fn muged_split_transform(muged_split_array& input, MUGED_FFTDirection direction, muged_split_array& output)
+	 *
+	 * Calculates transform of split-complex samples with cached plan, normalizes inverse transform
+	 *
+	 * @param input - signal or spectrum
+	 * @param direction - forward or inverse transform
+	 * @param output - result (input.length samples with imaginary part, already allocated, may be input)
+	 */
+	void muged_split_transform(muged_split_array& input, MUGED_FFTDirection direction, muged_split_array& output);
+
+	/**
+	 * @fn muged_execute_split_correlation(muged_split_array& fsignal, muged_split_array& ssignal, size_t min_lag, size_t max_lag, muged_split_array& correlation)
+	 *
+	 * Calculates 1D correlation of split-complex signals
+	 *
+	 * @param fsignal - first 1D signal
+	 * @param ssignal - second 1D signal
+	 * @param min_lag - minimum range
+	 * @param max_lag - maximum range
+	 * @param correlation - result (2*max_lag+1 samples, already allocated, imaginary part
+	 *                      is written if present)
+	 */
+	void muged_execute_split_correlation(muged_split_array& fsignal, muged_split_array& ssignal,
+	                                     size_t min_lag, size_t max_lag,
+	                                     muged_split_array& correlation);
+
+	/**
+	 * @fn muged_complex_samples(const MUGED_SampleView& view)
+	 *
+	 * Returns complex samples of view, converted into scratch arena unless they
+	 * are complex already (caller holds MUGED_ArenaScope)
+	 *
+	 * @param view - samples
+	 * @return muged_array - complex samples, not to be modified
+	 */
+	muged_array muged_complex_samples(const MUGED_SampleView& view);
+
+	/**
+	 * @fn muged_check_capacity(size_t capacity, size_t length)
 	 *
-	 * @param radix_2_signal - time samples
-	 * @return muged_array* - signal in time domain
+	 * Throws ERR_ARRAY_LENGTH if caller buffer is too short for result
 	 *
-	 * IFFT(n, a0, a1, a2, a3, ... , an-1)
-	 * {
-	 * 	if (n == 1) return a0;
-	 * 	w = e^2πi/n;
-	 * 	(e0, e1, e2, e3,..., en/2-1) = IFFT(n/2, a0, a2, a4, a6,..., an-2);
-	 * 	(d0, d1, d2, d3,..., dn/2-1) = IFFT(n/2, a1, a3, a5, a7,..., an-1);
-	 * 	for k = 0 to n/2-1
-	 * 	{
-	 * 		y_k = e_k + w^k*d_k;
-	 * 		y_k+n/2 = e_k – w^k*d_k
-	 * 	};
-	 * 	return (y1, y2, y3,..., yn-1);
-	 * }
+	 * @param capacity - length of caller buffer
+	 * @param length - length of result
 	 */
-	muged_array* muged_ifft_kernel(muged_array& radix_2_signal);
+	void muged_check_capacity(size_t capacity, size_t length);
 
 };
 
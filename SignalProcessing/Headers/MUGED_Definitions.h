@@ -25,6 +25,55 @@ using namespace std;
 #define INFO(dummy,args...)
 #endif
 
+/// Alignment of buffers allocated by muged_aligned_alloc (cache line, AVX-512 register)
+#define MUGED_ALIGNMENT 64
+
+/// Largest integer exponent calculated by MUGED_Complex::muged_pow without polar form
+#define MUGED_COMPLEX_INTEGER_POWER 64
+
+/// Largest prime factor calculated by mixed-radix FFT, larger ones use Bluestein algorithm
+#define MUGED_FFT_MAX_RADIX 31
+#define MUGED_FFT_MAX_FACTORS 64
+
+/// Shortest FFT calculated by parallel six-step algorithm
+#define MUGED_FFT_SIX_STEP_LENGTH (1 << 20)
+
+/// Most parts of six-step pass processed in parallel, each has its own scratch
+#define MUGED_FFT_SIX_STEP_PARTS 64
+
+/// Side of square block of blocked matrix transpose
+#define MUGED_TRANSPOSE_BLOCK 32
+
+/// Smallest number of samples worth processing in parallel
+#define MUGED_PARALLEL_LENGTH (1 << 16)
+
+/// Samples of one partial result of parallel reduction, and of its leaves reduced sequentially
+#define MUGED_REDUCTION_CHUNK 4096
+#define MUGED_REDUCTION_LEAF 128
+
+/// Default compression of quantile sketch (about compression centroids are kept)
+#define MUGED_SKETCH_COMPRESSION 100
+
+/// Limits of FFT plan cache
+#define MUGED_FFT_CACHE_PLANS 64
+#define MUGED_FFT_CACHE_BYTES (64 << 20)
+
+/// Largest |x| of polynomial sine and cosine, larger arguments use libm
+#define MUGED_VECTOR_TRIG_LIMIT 1e6
+
 #define ERR_NOT_IMPLEMENTED "This method is not implemented yet"
+#define ERR_ARRAY_LENGTH "Array is too short"
+#define ERR_ARRAY_MISMATCH "Arrays have different lengths"
+#define ERR_FFT_LENGTH "FFT length is not supported"
+#define ERR_FFT_DIRECTION "FFT plan has wrong direction"
+#define ERR_FFT_TYPE "FFT plan has wrong type"
+#define ERR_FFT_SCRATCH "FFT plan has no scratch"
+#define ERR_MATRIX_LAYOUT "Matrix rows are not equally spaced"
+#define ERR_MATRIX_RANGE "Matrix view is out of range"
+#define ERR_SPLIT_IMAG "Split-complex array has no imaginary part"
+#define ERR_WINDOW_LENGTH "Window length has to be positive"
+#define ERR_SKETCH_COMPRESSION "Sketch compression has to be at least 1"
+#define ERR_HISTOGRAM_RANGE "Histogram needs bins and range with maximum above minimum"
+#define ERR_HISTOGRAM_LAYOUT "Histograms have different bins"
 
 #endif /* _MUGED_DEFINITIONS_H_ */
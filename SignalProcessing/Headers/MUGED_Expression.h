@@ -0,0 +1,564 @@
+/**
+ * @file MUGED_Expression.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains lazy element-wise expressions over arrays (expression templates)
+ *
+ * Operators and functions below don't calculate anything, they build a tree of
+ * expression types. Whole tree is evaluated by muged_evaluate() or muged_assign()
+ * in a single loop, without temporary arrays, e.g.
+ *
+ *   muged_real_array power;
+ *   muged_evaluate(muged_abs(muged_conj(x) * y) / length, power);
+ *
+ * Expressions keep pointers to arrays, not copies, so arrays must live until
+ * expression is evaluated.
+ */
+
+#ifndef _MUGED_EXPRESSION_H_
+#define _MUGED_EXPRESSION_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+#include "MUGED_Parallel.h"
+
+/**
+ * @class MUGED_Expression
+ * @brief Base of every expression (CRTP), E is the derived expression type
+ *
+ * Derived type has muged_length(), operator[] returning sample i and constant
+ * muged_constant - true if expression has the same value for every index.
+ */
+template <class E>
+class MUGED_Expression
+{
+public:
+
+	/**
+	 * @return const E& - derived expression
+	 */
+	const E& muged_derived() const noexcept
+	{
+		return static_cast<const E&>(*this);
+	}
+
+	/**
+	 * @return size_t - number of samples
+	 */
+	size_t muged_length() const noexcept
+	{
+		return muged_derived().muged_length();
+	}
+
+	/**
+	 * @param i - index of sample
+	 * @return muged_scalar - value of sample i
+	 */
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		return muged_derived()[i];
+	}
+};
+
+/**
+ * @class MUGED_ArrayExpression
+ * @brief Samples of complex array
+ */
+class MUGED_ArrayExpression : public MUGED_Expression<MUGED_ArrayExpression>
+{
+public:
+	static const bool muged_constant = false;
+
+	explicit MUGED_ArrayExpression(const muged_array& array) noexcept
+		: array(array.array), length(array.length)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->length;
+	}
+
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		return this->array[i];
+	}
+
+private:
+	const muged_scalar* array;
+	size_t length;
+};
+
+/**
+ * @class MUGED_RealArrayExpression
+ * @brief Samples of real array as complex values with zero imaginary part
+ */
+class MUGED_RealArrayExpression : public MUGED_Expression<MUGED_RealArrayExpression>
+{
+public:
+	static const bool muged_constant = false;
+
+	explicit MUGED_RealArrayExpression(const muged_real_array& array) noexcept
+		: array(array.array), length(array.length)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->length;
+	}
+
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		return muged_scalar(this->array[i], 0);
+	}
+
+private:
+	const double* array;
+	size_t length;
+};
+
+/**
+ * @class MUGED_ConstantExpression
+ * @brief The same value for every index, matches expressions of any length
+ */
+class MUGED_ConstantExpression : public MUGED_Expression<MUGED_ConstantExpression>
+{
+public:
+	static const bool muged_constant = true;
+
+	explicit MUGED_ConstantExpression(const muged_scalar& value) noexcept
+		: value(value)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return 0;
+	}
+
+	muged_scalar operator[](size_t) const noexcept
+	{
+		return this->value;
+	}
+
+private:
+	muged_scalar value;
+};
+
+/**
+ * @class MUGED_BinaryExpression
+ * @brief Operation applied to samples of two expressions with the same index
+ */
+template <class Operation, class L, class R>
+class MUGED_BinaryExpression : public MUGED_Expression<MUGED_BinaryExpression<Operation, L, R> >
+{
+public:
+	static const bool muged_constant = L::muged_constant && R::muged_constant;
+
+	/**
+	 * Length of expressions is checked, MUGED_DSPException is thrown if they differ
+	 */
+	MUGED_BinaryExpression(const L& left, const R& right)
+		: left(left), right(right)
+	{
+		if (!L::muged_constant && !R::muged_constant && left.muged_length() != right.muged_length())
+			throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return L::muged_constant ? this->right.muged_length() : this->left.muged_length();
+	}
+
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		return Operation::muged_apply(this->left[i], this->right[i]);
+	}
+
+private:
+	L left;
+	R right;
+};
+
+/**
+ * @class MUGED_UnaryExpression
+ * @brief Operation applied to every sample of expression
+ */
+template <class Operation, class E>
+class MUGED_UnaryExpression : public MUGED_Expression<MUGED_UnaryExpression<Operation, E> >
+{
+public:
+	static const bool muged_constant = E::muged_constant;
+
+	MUGED_UnaryExpression(const Operation& operation, const E& expression) noexcept
+		: operation(operation), expression(expression)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->expression.muged_length();
+	}
+
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		return this->operation.muged_apply(this->expression[i]);
+	}
+
+private:
+	Operation operation;
+	E expression;
+};
+
+/**
+ * Operations of expressions. Results of real functions (abs, angle) have zero imaginary part.
+ */
+struct muged_expression_add
+{
+	static muged_scalar muged_apply(const muged_scalar& left, const muged_scalar& right) noexcept
+	{
+		return left + right;
+	}
+};
+
+struct muged_expression_subtract
+{
+	static muged_scalar muged_apply(const muged_scalar& left, const muged_scalar& right) noexcept
+	{
+		return left - right;
+	}
+};
+
+struct muged_expression_multiply
+{
+	static muged_scalar muged_apply(const muged_scalar& left, const muged_scalar& right) noexcept
+	{
+		return left * right;
+	}
+};
+
+struct muged_expression_divide
+{
+	static muged_scalar muged_apply(const muged_scalar& left, const muged_scalar& right) noexcept
+	{
+		double denominator = right.muged_real() * right.muged_real() + right.muged_imag() * right.muged_imag();
+
+		return muged_scalar((left.muged_real() * right.muged_real() + left.muged_imag() * right.muged_imag()) / denominator,
+		                    (left.muged_imag() * right.muged_real() - left.muged_real() * right.muged_imag()) / denominator);
+	}
+};
+
+struct muged_expression_scale
+{
+	double factor;
+
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return muged_scalar(value.muged_real() * this->factor, value.muged_imag() * this->factor);
+	}
+};
+
+struct muged_expression_conj
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return value.muged_conj();
+	}
+};
+
+struct muged_expression_abs
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return muged_scalar(value.muged_abs(), 0);
+	}
+};
+
+struct muged_expression_abs2
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return muged_scalar(value.muged_real() * value.muged_real() + value.muged_imag() * value.muged_imag(), 0);
+	}
+};
+
+struct muged_expression_angle
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return muged_scalar(value.muged_angle(), 0);
+	}
+};
+
+struct muged_expression_exp
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		double magnitude = exp(value.muged_real());
+		return muged_scalar(magnitude * cos(value.muged_imag()), magnitude * sin(value.muged_imag()));
+	}
+};
+
+struct muged_expression_log
+{
+	muged_scalar muged_apply(const muged_scalar& value) const noexcept
+	{
+		return muged_scalar(log(value.muged_abs()), value.muged_angle());
+	}
+};
+
+/**
+ * Binary operators of expressions, arrays and constants
+ */
+#define MUGED_EXPRESSION_OPERATOR(OPERATOR, OPERATION)                                                                         \
+template <class L, class R>                                                                                                   \
+inline MUGED_BinaryExpression<OPERATION, L, R>                                                                                \
+operator OPERATOR(const MUGED_Expression<L>& left, const MUGED_Expression<R>& right)                                          \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, L, R>(left.muged_derived(), right.muged_derived());                              \
+}                                                                                                                             \
+                                                                                                                              \
+template <class L>                                                                                                            \
+inline MUGED_BinaryExpression<OPERATION, L, MUGED_ArrayExpression>                                                            \
+operator OPERATOR(const MUGED_Expression<L>& left, const muged_array& right)                                                  \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, L, MUGED_ArrayExpression>(left.muged_derived(), MUGED_ArrayExpression(right));   \
+}                                                                                                                             \
+                                                                                                                              \
+template <class R>                                                                                                            \
+inline MUGED_BinaryExpression<OPERATION, MUGED_ArrayExpression, R>                                                            \
+operator OPERATOR(const muged_array& left, const MUGED_Expression<R>& right)                                                  \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, MUGED_ArrayExpression, R>(MUGED_ArrayExpression(left), right.muged_derived());   \
+}                                                                                                                             \
+                                                                                                                              \
+inline MUGED_BinaryExpression<OPERATION, MUGED_ArrayExpression, MUGED_ArrayExpression>                                        \
+operator OPERATOR(const muged_array& left, const muged_array& right)                                                          \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, MUGED_ArrayExpression, MUGED_ArrayExpression>(MUGED_ArrayExpression(left),       \
+	                                                                                       MUGED_ArrayExpression(right));     \
+}                                                                                                                             \
+                                                                                                                              \
+template <class L>                                                                                                            \
+inline MUGED_BinaryExpression<OPERATION, L, MUGED_ConstantExpression>                                                         \
+operator OPERATOR(const MUGED_Expression<L>& left, const muged_scalar& right)                                                 \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, L, MUGED_ConstantExpression>(left.muged_derived(), MUGED_ConstantExpression(right)); \
+}                                                                                                                             \
+                                                                                                                              \
+template <class R>                                                                                                            \
+inline MUGED_BinaryExpression<OPERATION, MUGED_ConstantExpression, R>                                                         \
+operator OPERATOR(const muged_scalar& left, const MUGED_Expression<R>& right)                                                 \
+{                                                                                                                             \
+	return MUGED_BinaryExpression<OPERATION, MUGED_ConstantExpression, R>(MUGED_ConstantExpression(left), right.muged_derived()); \
+}                                                                                                                             \
+                                                                                                                              \
+inline MUGED_BinaryExpression<OPERATION, MUGED_ArrayExpression, MUGED_ConstantExpression>                                     \
+operator OPERATOR(const muged_array& left, const muged_scalar& right)                                                         \
+{                                                                                                                             \
+	return MUGED_ArrayExpression(left) OPERATOR right;                                                                        \
+}                                                                                                                             \
+                                                                                                                              \
+inline MUGED_BinaryExpression<OPERATION, MUGED_ConstantExpression, MUGED_ArrayExpression>                                     \
+operator OPERATOR(const muged_scalar& left, const muged_array& right)                                                         \
+{                                                                                                                             \
+	return left OPERATOR MUGED_ArrayExpression(right);                                                                        \
+}
+
+MUGED_EXPRESSION_OPERATOR(+, muged_expression_add)
+MUGED_EXPRESSION_OPERATOR(-, muged_expression_subtract)
+MUGED_EXPRESSION_OPERATOR(*, muged_expression_multiply)
+MUGED_EXPRESSION_OPERATOR(/, muged_expression_divide)
+
+#undef MUGED_EXPRESSION_OPERATOR
+
+/**
+ * Multiplication and division by real value (division multiplies by reciprocal) and negation
+ */
+template <class E>
+inline MUGED_UnaryExpression<muged_expression_scale, E> operator*(const MUGED_Expression<E>& expression, double factor)
+{
+	muged_expression_scale operation = { factor };
+	return MUGED_UnaryExpression<muged_expression_scale, E>(operation, expression.muged_derived());
+}
+
+template <class E>
+inline MUGED_UnaryExpression<muged_expression_scale, E> operator*(double factor, const MUGED_Expression<E>& expression)
+{
+	return expression * factor;
+}
+
+template <class E>
+inline MUGED_UnaryExpression<muged_expression_scale, E> operator/(const MUGED_Expression<E>& expression, double value)
+{
+	return expression * (1.0 / value);
+}
+
+template <class E>
+inline MUGED_UnaryExpression<muged_expression_scale, E> operator-(const MUGED_Expression<E>& expression)
+{
+	return expression * -1.0;
+}
+
+inline MUGED_UnaryExpression<muged_expression_scale, MUGED_ArrayExpression> operator*(const muged_array& array, double factor)
+{
+	return MUGED_ArrayExpression(array) * factor;
+}
+
+inline MUGED_UnaryExpression<muged_expression_scale, MUGED_ArrayExpression> operator*(double factor, const muged_array& array)
+{
+	return MUGED_ArrayExpression(array) * factor;
+}
+
+inline MUGED_UnaryExpression<muged_expression_scale, MUGED_ArrayExpression> operator/(const muged_array& array, double value)
+{
+	return MUGED_ArrayExpression(array) / value;
+}
+
+inline MUGED_UnaryExpression<muged_expression_scale, MUGED_ArrayExpression> operator-(const muged_array& array)
+{
+	return -MUGED_ArrayExpression(array);
+}
+
+/**
+ * Element-wise functions of expressions and arrays
+ */
+#define MUGED_EXPRESSION_FUNCTION(FUNCTION, OPERATION)                                              \
+template <class E>                                                                                  \
+inline MUGED_UnaryExpression<OPERATION, E> FUNCTION(const MUGED_Expression<E>& expression)          \
+{                                                                                                   \
+	return MUGED_UnaryExpression<OPERATION, E>(OPERATION(), expression.muged_derived());            \
+}                                                                                                   \
+                                                                                                    \
+inline MUGED_UnaryExpression<OPERATION, MUGED_ArrayExpression> FUNCTION(const muged_array& array)   \
+{                                                                                                   \
+	return MUGED_UnaryExpression<OPERATION, MUGED_ArrayExpression>(OPERATION(), MUGED_ArrayExpression(array)); \
+}
+
+MUGED_EXPRESSION_FUNCTION(muged_conj, muged_expression_conj)
+MUGED_EXPRESSION_FUNCTION(muged_abs, muged_expression_abs)
+MUGED_EXPRESSION_FUNCTION(muged_abs2, muged_expression_abs2)
+MUGED_EXPRESSION_FUNCTION(muged_angle, muged_expression_angle)
+MUGED_EXPRESSION_FUNCTION(muged_exp, muged_expression_exp)
+MUGED_EXPRESSION_FUNCTION(muged_log, muged_expression_log)
+
+#undef MUGED_EXPRESSION_FUNCTION
+
+/**
+ * @fn muged_expression(const muged_array& array)
+ *
+ * @param array - complex array
+ * @return MUGED_ArrayExpression - array as expression, e.g. to scale it by real value
+ */
+inline MUGED_ArrayExpression muged_expression(const muged_array& array) noexcept
+{
+	return MUGED_ArrayExpression(array);
+}
+
+/**
+ * @fn muged_expression(const muged_real_array& array)
+ *
+ * @param array - real array
+ * @return MUGED_RealArrayExpression - array as expression of complex values
+ */
+inline MUGED_RealArrayExpression muged_expression(const muged_real_array& array) noexcept
+{
+	return MUGED_RealArrayExpression(array);
+}
+
+/**
+ * @fn muged_assign(muged_array& result, const MUGED_Expression<E>& expression)
+ *
+ * Evaluates expression into existing array in one pass, long arrays are split between threads.
+ * Every sample depends only on samples of the same index, so result may be used in expression.
+ *
+ * @param result - result, the same length as expression
+ * @param expression - expression
+ */
+template <class E>
+void muged_assign(muged_array& result, const MUGED_Expression<E>& expression)
+{
+	if (!E::muged_constant && expression.muged_length() != result.length)
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	const E& tree = expression.muged_derived();
+	muged_scalar* output = result.array;
+
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+			output[i] = tree[i];
+	};
+
+	if (result.length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(result.length, body);
+	else
+		body(0, result.length);
+}
+
+/**
+ * @fn muged_assign(muged_real_array& result, const MUGED_Expression<E>& expression)
+ *
+ * Evaluates expression into existing real array, imaginary parts are dropped
+ *
+ * @param result - result, the same length as expression
+ * @param expression - expression
+ */
+template <class E>
+void muged_assign(muged_real_array& result, const MUGED_Expression<E>& expression)
+{
+	if (!E::muged_constant && expression.muged_length() != result.length)
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	const E& tree = expression.muged_derived();
+	double* output = result.array;
+
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+			output[i] = tree[i].muged_real();
+	};
+
+	if (result.length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(result.length, body);
+	else
+		body(0, result.length);
+}
+
+/**
+ * @fn muged_evaluate(const MUGED_Expression<E>& expression, muged_array& result)
+ *
+ * Evaluates expression in one pass
+ *
+ * @param expression - expression of non-constant length
+ * @param result - result (memory will be allocated)
+ */
+template <class E>
+void muged_evaluate(const MUGED_Expression<E>& expression, muged_array& result)
+{
+	result.length = expression.muged_length();
+	result.array = new muged_scalar[result.length];
+
+	muged_assign(result, expression);
+}
+
+/**
+ * @fn muged_evaluate(const MUGED_Expression<E>& expression, muged_real_array& result)
+ *
+ * Evaluates expression in one pass, imaginary parts are dropped
+ *
+ * @param expression - expression of non-constant length
+ * @param result - result (memory will be allocated)
+ */
+template <class E>
+void muged_evaluate(const MUGED_Expression<E>& expression, muged_real_array& result)
+{
+	result.length = expression.muged_length();
+	result.array = new double[result.length];
+
+	muged_assign(result, expression);
+}
+
+#endif /* _MUGED_EXPRESSION_H_ */
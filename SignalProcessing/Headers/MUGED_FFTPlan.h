@@ -0,0 +1,423 @@
+/**
+ * @file MUGED_FFTPlan.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains reusable FFT plan
+ */
+
+#ifndef _MUGED_FFTPLAN_H_
+#define _MUGED_FFTPLAN_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @enum MUGED_FFTDirection
+ * @brief Direction of transform, value is the sign of twiddle factor exponent
+ */
+enum MUGED_FFTDirection
+{
+	MUGED_FFT_FORWARD = -1,
+	MUGED_FFT_INVERSE = 1
+};
+
+/**
+ * @enum MUGED_FFTPrecision
+ * @brief Precision of samples processed by plan
+ */
+enum MUGED_FFTPrecision
+{
+	MUGED_FFT_DOUBLE
+};
+
+/**
+ * @enum MUGED_FFTType
+ * @brief Type of transformed samples
+ */
+enum MUGED_FFTType
+{
+	/// Complex samples, N complex outputs
+	MUGED_FFT_COMPLEX,
+
+	/// Real samples, N/2+1 complex outputs (the rest follows from Hermitian symmetry)
+	MUGED_FFT_REAL
+};
+
+/**
+ * @enum MUGED_FFTAlgorithm
+ * @brief Algorithm selected by plan for its length
+ */
+enum MUGED_FFTAlgorithm
+{
+	/// Iterative radix-4 (radix-2 stages combined in pairs), length is power of two
+	MUGED_FFT_RADIX_2,
+
+	/// Mixed-radix (4, 2, 3, 5, 7 and small primes), length has only small prime factors
+	MUGED_FFT_MIXED_RADIX,
+
+	/// Bluestein (chirp-z) convolution, length has large prime factor
+	MUGED_FFT_BLUESTEIN,
+
+	/// Six-step (N1 x N2 matrix) with sub-transforms calculated in parallel,
+	/// length is at least MUGED_FFT_SIX_STEP_LENGTH and has factor close to its square root
+	MUGED_FFT_SIX_STEP
+};
+
+/**
+ * @fn muged_transpose(const muged_scalar* input, size_t rows, size_t columns, muged_scalar* output)
+ *
+ * Transposes matrix stored row by row in square blocks of MUGED_TRANSPOSE_BLOCK,
+ * blocks are distributed across threads for large matrices
+ *
+ * @param input - rows x columns matrix
+ * @param rows - number of rows
+ * @param columns - number of columns
+ * @param output - result, columns x rows matrix (different buffer than input)
+ */
+void muged_transpose(const muged_scalar* input, size_t rows, size_t columns, muged_scalar* output);
+
+/**
+ * @fn muged_transpose(const muged_scalar* input, size_t rows, size_t columns, size_t input_stride, muged_scalar* output, size_t output_stride)
+ *
+ * Transposes matrix with row strides, e.g. tile of larger matrix
+ *
+ * @param input - rows x columns matrix, row r starts at input + r*input_stride
+ * @param rows - number of rows
+ * @param columns - number of columns
+ * @param input_stride - distance between rows of input, at least columns
+ * @param output - result, columns x rows matrix, row c starts at output + c*output_stride
+ * @param output_stride - distance between rows of output, at least rows
+ */
+void muged_transpose(const muged_scalar* input, size_t rows, size_t columns, size_t input_stride,
+                     muged_scalar* output, size_t output_stride);
+
+/**
+ * @class MUGED_FFTPlan
+ * @author Kamil Sorokosz
+ * @brief Precomputed state of FFT for one length and direction.
+ *
+ * Plan is created once and executed many times. Any length is supported
+ * without zero padding:
+ * - power of two - iterative radix-4 passes over bit-reversed samples (with
+ *   one radix-2 stage for odd powers), twiddle factors are stored pass by pass
+ *   so every pass reads them contiguously
+ * - product of primes up to MUGED_FFT_MAX_RADIX - mixed-radix Cooley–Tukey
+ * - other lengths - Bluestein algorithm, convolution with chirp calculated
+ *   by power of two plan
+ * - long lengths N = N1*N2 (N1, N2 close to sqrt(N)) - six-step algorithm:
+ *   transpose, N2 transforms of length N1, twiddle multiplication, transpose,
+ *   N1 transforms of length N2, transpose. Sub-transforms fit in cache and are
+ *   spread across threads (muged_parallel_for)
+ *
+ * Real plan of even length packs N real samples into N/2 complex ones and
+ * calculates half length complex transform, spectrum is separated using
+ * Hermitian symmetry. Real plan of odd length uses complex transform of length N.
+ *
+ * Plan owns twiddle factors, permutation, factorization and scratch buffer
+ * used by non-const execution. Plan whose every execution gets scratch from
+ * the caller (e.g. one of MUGED_FFTPlanCache) is created without the buffer.
+ *
+ * Inverse plan calculates unnormalized transform (no division by length).
+ */
+class MUGED_FFTPlan
+{
+public:
+
+	/**
+	 * @fn MUGED_FFTPlan(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type, bool own_scratch)
+	 *
+	 * Creates plan
+	 *
+	 * @param length - transform length (number of complex or real samples)
+	 * @param direction - forward or inverse transform
+	 * @param type - complex or real transform
+	 * @param own_scratch - false if plan is executed only with scratch of the caller
+	 */
+	MUGED_FFTPlan(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type = MUGED_FFT_COMPLEX,
+	              bool own_scratch = true);
+
+	/**
+	 * Default destructor
+	 */
+	~MUGED_FFTPlan();
+
+	/**
+	 * @fn muged_length() const
+	 *
+	 * @return size_t - transform length
+	 */
+	size_t muged_length() const;
+
+	/**
+	 * @fn muged_direction() const
+	 *
+	 * @return MUGED_FFTDirection - transform direction
+	 */
+	MUGED_FFTDirection muged_direction() const;
+
+	/**
+	 * @fn muged_type() const
+	 *
+	 * @return MUGED_FFTType - complex or real transform
+	 */
+	MUGED_FFTType muged_type() const;
+
+	/**
+	 * @fn muged_algorithm() const
+	 *
+	 * @return MUGED_FFTAlgorithm - algorithm used for plan length
+	 */
+	MUGED_FFTAlgorithm muged_algorithm() const;
+
+	/**
+	 * @fn muged_precision() const
+	 *
+	 * @return MUGED_FFTPrecision - precision of processed samples
+	 */
+	MUGED_FFTPrecision muged_precision() const;
+
+	/**
+	 * @fn muged_scratch_length() const
+	 *
+	 * @return size_t - number of scalars needed as scratch by muged_execute
+	 */
+	size_t muged_scratch_length() const;
+
+	/**
+	 * @fn muged_memory_size() const
+	 *
+	 * @return size_t - number of bytes held by the plan
+	 */
+	size_t muged_memory_size() const;
+
+	/**
+	 * @fn muged_execute(const muged_scalar* input, size_t input_length, muged_scalar* output, muged_scalar* scratch) const
+	 *
+	 * Calculates complex transform. Input shorter than plan length is zero padded,
+	 * longer one is truncated. Input and output may be the same buffer.
+	 * Method doesn't modify the plan, so one plan may be executed by many threads.
+	 *
+	 * @param input - input samples
+	 * @param input_length - number of input samples
+	 * @param output - result (muged_length() scalars)
+	 * @param scratch - muged_scratch_length() scalars of temporary memory (may be NULL if length is 0)
+	 */
+	void muged_execute(const muged_scalar* input, size_t input_length,
+	                   muged_scalar* output, muged_scalar* scratch) const;
+
+	/**
+	 * @fn muged_execute(const muged_scalar* input, size_t input_length, muged_scalar* output)
+	 *
+	 * Calculates transform using scratch buffer owned by the plan.
+	 * Plan shouldn't be shared by threads calling this method.
+	 * Throws ERR_FFT_SCRATCH if plan was created without scratch.
+	 *
+	 * @param input - input samples
+	 * @param input_length - number of input samples
+	 * @param output - result (muged_length() scalars)
+	 */
+	void muged_execute(const muged_scalar* input, size_t input_length, muged_scalar* output);
+
+	/**
+	 * @fn muged_execute_batch(const muged_scalar* input, size_t stride, size_t distance, size_t count, muged_scalar* output, muged_scalar* scratch) const
+	 *
+	 * Calculates complex transforms of many signals of plan length. Sample n of
+	 * signal k is input[k*distance + n*stride]. Strided signal is gathered into its
+	 * output slot and transformed in place, so all transforms share twiddle factors
+	 * kept in cache.
+	 *
+	 * @param input - input signals
+	 * @param stride - distance between samples of one signal
+	 * @param distance - distance between first samples of consecutive signals
+	 * @param count - number of signals
+	 * @param output - result, count*muged_length() scalars, spectrum k starts at k*muged_length()
+	 * @param scratch - muged_scratch_length() scalars of temporary memory
+	 */
+	void muged_execute_batch(const muged_scalar* input, size_t stride, size_t distance, size_t count,
+	                         muged_scalar* output, muged_scalar* scratch) const;
+
+	/**
+	 * @fn muged_execute_real(const double* input, size_t input_length, muged_scalar* output, muged_scalar* scratch) const
+	 *
+	 * Calculates transform of real signal with forward real plan.
+	 * Input shorter than plan length is zero padded, longer one is truncated.
+	 *
+	 * @param input - real samples
+	 * @param input_length - number of input samples
+	 * @param output - result, muged_length()/2+1 spectrum bins
+	 * @param scratch - muged_scratch_length() scalars of temporary memory
+	 */
+	void muged_execute_real(const double* input, size_t input_length,
+	                        muged_scalar* output, muged_scalar* scratch) const;
+
+	/**
+	 * @fn muged_execute_real(const muged_scalar* input, double* output, muged_scalar* scratch) const
+	 *
+	 * Calculates real signal from its spectrum with inverse real plan (unnormalized)
+	 *
+	 * @param input - muged_length()/2+1 spectrum bins
+	 * @param output - result, muged_length() real samples
+	 * @param scratch - muged_scratch_length() scalars of temporary memory
+	 */
+	void muged_execute_real(const muged_scalar* input, double* output, muged_scalar* scratch) const;
+
+private:
+
+	MUGED_FFTPlan(const MUGED_FFTPlan& plan);
+	MUGED_FFTPlan& operator=(const MUGED_FFTPlan& plan);
+
+	/**
+	 * @fn muged_radix_2(const muged_scalar* input, size_t input_length, muged_scalar* output) const
+	 *
+	 * Iterative power of two transform
+	 */
+	void muged_radix_2(const muged_scalar* input, size_t input_length, muged_scalar* output) const;
+
+	/**
+	 * @fn muged_first_quarter() const
+	 *
+	 * @return size_t - quarter block size of the first radix-4 pass (2 if number of stages is odd)
+	 */
+	size_t muged_first_quarter() const;
+
+	/**
+	 * @fn muged_mixed_radix(muged_scalar* output, const muged_scalar* input, size_t stride, const size_t* factors) const
+	 *
+	 * Recursive mixed-radix decimation in time. Input of length p*m read with
+	 * stride is transformed into p*m contiguous outputs.
+	 *
+	 * @param output - result
+	 * @param input - input samples
+	 * @param stride - distance between input samples
+	 * @param factors - remaining factorization (p, m, p', m', ...)
+	 */
+	void muged_mixed_radix(muged_scalar* output, const muged_scalar* input,
+	                       size_t stride, const size_t* factors) const;
+
+	/**
+	 * @fn muged_six_step(const muged_scalar* input, size_t input_length, muged_scalar* output, muged_scalar* scratch) const
+	 *
+	 * Six-step transform, n = N2*n1 + n2, k = k1 + N1*k2:
+	 * X_k = sum_n2(W_N2^(n2*k2) * W_N^(n2*k1) * sum_n1(x_n * W_N1^(n1*k1)))
+	 */
+	void muged_six_step(const muged_scalar* input, size_t input_length,
+	                    muged_scalar* output, muged_scalar* scratch) const;
+
+	/**
+	 * @fn muged_six_step_part_length() const
+	 *
+	 * @return size_t - number of scalars of scratch used by one part of six-step pass
+	 */
+	size_t muged_six_step_part_length() const;
+
+	/**
+	 * @fn muged_bluestein(const muged_scalar* input, size_t input_length, muged_scalar* output, muged_scalar* scratch) const
+	 *
+	 * Bluestein transform, X_k = w_k * sum(x_n * w_n * conj(w_k-n)), w_n = e^(direction*πi*n^2/N)
+	 */
+	void muged_bluestein(const muged_scalar* input, size_t input_length,
+	                     muged_scalar* output, muged_scalar* scratch) const;
+
+	/// Transform length
+	size_t length;
+
+	/// Transform direction
+	MUGED_FFTDirection direction;
+
+	/// Complex or real transform
+	MUGED_FFTType type;
+
+	/// Selected algorithm
+	MUGED_FFTAlgorithm algorithm;
+
+	/// Twiddle factors. Power of two: w^j, w^2j, w^3j of each radix-4 pass,
+	/// mixed-radix: e^(direction*2πi*k/N) for k = 0..N-1,
+	/// six-step: W_N^(N1*j) for j < N2 followed by W_N^j for j < N1
+	/// (W_N^m is product of both parts, so table is not of length N)
+	muged_scalar* twiddles;
+
+	/// Bit-reversal permutation (radix-2)
+	size_t* bit_reversal;
+
+	/// Factorization as pairs (radix, remaining length), mixed-radix
+	size_t factors[2 * MUGED_FFT_MAX_FACTORS];
+
+	/// Chirp w_n (Bluestein)
+	muged_scalar* chirp;
+
+	/// Spectrum of conjugated chirp divided by convolution length (Bluestein)
+	muged_scalar* chirp_spectrum;
+
+	/// Forward power of two plan for convolution (Bluestein)
+	MUGED_FFTPlan* convolution_plan;
+
+	/// Plan of length N1, transforms columns of N1 x N2 matrix (six-step)
+	MUGED_FFTPlan* column_plan;
+
+	/// Plan of length N2, transforms rows of N1 x N2 matrix (six-step)
+	MUGED_FFTPlan* row_plan;
+
+	/// Complex plan of length N/2 (even) or N (odd) used by real plan
+	MUGED_FFTPlan* complex_plan;
+
+	/// e^(direction*2πi*k/N) for k = 0..N/2, separation of real spectrum
+	muged_scalar* real_twiddles;
+
+	/// Scratch buffer of non-const execution
+	muged_scalar* scratch;
+};
+
+inline size_t MUGED_FFTPlan::muged_length() const
+{
+	return this->length;
+}
+
+inline MUGED_FFTDirection MUGED_FFTPlan::muged_direction() const
+{
+	return this->direction;
+}
+
+inline MUGED_FFTType MUGED_FFTPlan::muged_type() const
+{
+	return this->type;
+}
+
+inline MUGED_FFTAlgorithm MUGED_FFTPlan::muged_algorithm() const
+{
+	return this->algorithm;
+}
+
+inline MUGED_FFTPrecision MUGED_FFTPlan::muged_precision() const
+{
+	return MUGED_FFT_DOUBLE;
+}
+
+inline size_t MUGED_FFTPlan::muged_six_step_part_length() const
+{
+	size_t column_length = column_plan->muged_scratch_length();
+	size_t row_length = row_plan->muged_scratch_length();
+
+	return column_length > row_length ? column_length : row_length;
+}
+
+inline size_t MUGED_FFTPlan::muged_scratch_length() const
+{
+	if (type == MUGED_FFT_REAL)
+		return complex_plan->muged_length() + complex_plan->muged_scratch_length();
+
+	switch (algorithm)
+	{
+	case MUGED_FFT_MIXED_RADIX:
+		return length;
+	case MUGED_FFT_BLUESTEIN:
+		return convolution_plan->muged_length() + convolution_plan->muged_scratch_length();
+	case MUGED_FFT_SIX_STEP:
+		//Transposed matrix, then scratch of sub-transforms for every part
+		return length + MUGED_FFT_SIX_STEP_PARTS * muged_six_step_part_length();
+	default:
+		return 0;
+	}
+}
+
+#endif /* _MUGED_FFTPLAN_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @file MUGED_FFTPlanCache.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains thread-safe cache of FFT plans
+ */
+
+#ifndef _MUGED_FFTPLANCACHE_H_
+#define _MUGED_FFTPLANCACHE_H_
+
+#include <atomic>
+
+#include "MUGED_Definitions.h"
+#include "MUGED_FFTPlan.h"
+
+/**
+ * @class MUGED_FFTPlanCache
+ * @author Kamil Sorokosz
+ * @brief Cache of FFT plans keyed by length, direction, type and precision.
+ *
+ * Plans are stored in open addressing table of atomic pointers. Neither
+ * lookup nor insertion takes a lock - plan is built by every thread which
+ * missed it and published by compare-and-swap, losers delete their copies.
+ * Plans stay in the cache until it is destroyed, so returned pointers remain
+ * valid. Plans are created without own scratch (see MUGED_FFTPlan), they have
+ * to be executed with scratch of the caller.
+ * Memory is bounded by number of plans and number of bytes - when the limit
+ * is reached plan is created for the caller and not stored. Stored plans are
+ * not evicted, because lock-free readers could still use them. Every call with
+ * uncached length then builds its plan again, so code transforming many
+ * distinct lengths repeatedly should keep its own MUGED_FFTPlan objects and
+ * pass them to the plan overloads of MUGED_DSP.
+ */
+class MUGED_FFTPlanCache
+{
+public:
+
+	/**
+	 * @fn MUGED_FFTPlanCache(size_t max_plans, size_t max_bytes)
+	 *
+	 * Creates empty cache
+	 *
+	 * @param max_plans - maximum number of stored plans
+	 * @param max_bytes - maximum number of bytes held by stored plans
+	 */
+	MUGED_FFTPlanCache(size_t max_plans = MUGED_FFT_CACHE_PLANS,
+	                   size_t max_bytes = MUGED_FFT_CACHE_BYTES);
+
+	/**
+	 * Default destructor. Releases all stored plans.
+	 */
+	~MUGED_FFTPlanCache();
+
+	/**
+	 * @fn muged_plan(size_t length, MUGED_FFTDirection direction, bool& owned, MUGED_FFTType type, MUGED_FFTPrecision precision)
+	 *
+	 * Returns plan for specified transform, creating it on a miss
+	 *
+	 * @param length - transform length
+	 * @param direction - transform direction
+	 * @param owned - set to true if the cache is full and the caller has to delete the plan
+	 * @param type - complex or real transform
+	 * @param precision - precision of samples
+	 * @return const MUGED_FFTPlan* - plan
+	 */
+	const MUGED_FFTPlan* muged_plan(size_t length, MUGED_FFTDirection direction, bool& owned,
+	                                MUGED_FFTType type = MUGED_FFT_COMPLEX,
+	                                MUGED_FFTPrecision precision = MUGED_FFT_DOUBLE);
+
+	/**
+	 * @fn muged_hits() const
+	 *
+	 * @return size_t - number of lookups which found a stored plan
+	 */
+	size_t muged_hits() const;
+
+	/**
+	 * @fn muged_misses() const
+	 *
+	 * @return size_t - number of lookups which had to create a plan
+	 */
+	size_t muged_misses() const;
+
+	/**
+	 * @fn muged_size() const
+	 *
+	 * @return size_t - number of stored plans
+	 */
+	size_t muged_size() const;
+
+	/**
+	 * @fn muged_memory_size() const
+	 *
+	 * @return size_t - number of bytes held by stored plans
+	 */
+	size_t muged_memory_size() const;
+
+private:
+
+	MUGED_FFTPlanCache(const MUGED_FFTPlanCache& cache);
+	MUGED_FFTPlanCache& operator=(const MUGED_FFTPlanCache& cache);
+
+	/**
+	 * @fn muged_find(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type, MUGED_FFTPrecision precision, size_t& slot) const
+	 *
+	 * Lock-free lookup
+	 *
+	 * @param length - transform length
+	 * @param direction - transform direction
+	 * @param type - complex or real transform
+	 * @param precision - precision of samples
+	 * @param slot - first empty slot if plan was not found
+	 * @return const MUGED_FFTPlan* - stored plan or NULL
+	 */
+	const MUGED_FFTPlan* muged_find(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type,
+	                                MUGED_FFTPrecision precision, size_t& slot) const;
+
+	/// Table of plans, size is power of two greater than max_plans
+	std::atomic<MUGED_FFTPlan*>* slots;
+
+	/// Number of slots
+	size_t capacity;
+
+	/// Maximum number of stored plans
+	size_t max_plans;
+
+	/// Maximum number of bytes held by stored plans
+	size_t max_bytes;
+
+	/// Number of stored plans
+	std::atomic<size_t> plans;
+
+	/// Number of bytes held by stored plans
+	std::atomic<size_t> bytes;
+
+	/// Lookup statistics
+	std::atomic<size_t> hits;
+	std::atomic<size_t> misses;
+
+	/// Set when the first plan was not stored
+	std::atomic<bool> full_logged;
+};
+
+inline size_t MUGED_FFTPlanCache::muged_hits() const
+{
+	return hits.load(std::memory_order_relaxed);
+}
+
+inline size_t MUGED_FFTPlanCache::muged_misses() const
+{
+	return misses.load(std::memory_order_relaxed);
+}
+
+inline size_t MUGED_FFTPlanCache::muged_size() const
+{
+	return plans.load(std::memory_order_relaxed);
+}
+
+inline size_t MUGED_FFTPlanCache::muged_memory_size() const
+{
+	return bytes.load(std::memory_order_relaxed);
+}
+
+#endif /* _MUGED_FFTPLANCACHE_H_ */
@@ -0,0 +1,54 @@
+/**
+ * @file MUGED_Memory.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains aligned memory allocation
+ */
+
+#ifndef _MUGED_MEMORY_H_
+#define _MUGED_MEMORY_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @fn muged_aligned_alloc(size_t bytes)
+ *
+ * Allocates memory aligned to MUGED_ALIGNMENT bytes
+ *
+ * @param bytes - size of memory block
+ * @return void* - memory block (free with muged_aligned_free), std::bad_alloc is thrown on failure
+ */
+void* muged_aligned_alloc(size_t bytes);
+
+/**
+ * @fn muged_aligned_free(void* memory)
+ *
+ * Frees memory allocated with muged_aligned_alloc
+ *
+ * @param memory - memory block or NULL
+ */
+void muged_aligned_free(void* memory);
+
+/**
+ * @fn muged_split_allocate(muged_split_array& array, size_t length, bool complex)
+ *
+ * Allocates aligned parts of split-complex array, values are not initialized
+ *
+ * @param array - array (memory will be allocated)
+ * @param length - number of samples
+ * @param complex - if false only real parts are allocated (imag is NULL)
+ */
+void muged_split_allocate(muged_split_array& array, size_t length, bool complex = true);
+
+/**
+ * @fn muged_split_free(muged_split_array& array)
+ *
+ * Frees parts of split-complex array allocated with muged_split_allocate
+ *
+ * @param array - array
+ */
+void muged_split_free(muged_split_array& array);
+
+#endif /* _MUGED_MEMORY_H_ */
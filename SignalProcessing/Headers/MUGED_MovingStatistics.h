@@ -0,0 +1,175 @@
+/**
+ * @file MUGED_MovingStatistics.h
+ * @date 2026-10-18
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains statistics of sliding window
+ */
+
+#ifndef _MUGED_MOVINGSTATISTICS_H_
+#define _MUGED_MOVINGSTATISTICS_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+#include "MUGED_Array.h"
+
+/**
+ * @class MUGED_MovingStatistics
+ * @author Kamil Sorokosz
+ * @brief Mean, mean square, RMS and standard deviation of last window samples
+ *
+ * Window keeps running sums of samples and their products, every new sample
+ * is added to them and the oldest one subtracted, so update takes O(1). Sums
+ * are calculated again from samples of window once per window length, which
+ * bounds rounding error accumulated by subtraction. Samples are summed as
+ * deviations from shift, which is set to mean of window at every resum (like
+ * MUGED_Accumulator blocks), so standard deviation of signal with large
+ * offset doesn't cancel. Until window is full, statistics are calculated from
+ * samples added so far.
+ *
+ * Block methods write statistic of window ending at every input sample into
+ * output, input and output may be the same array.
+ */
+class MUGED_MovingStatistics
+{
+public:
+
+	/**
+	 * @fn MUGED_MovingStatistics(size_t window)
+	 *
+	 * @param window - number of samples in window (ERR_WINDOW_LENGTH is thrown for 0)
+	 */
+	explicit MUGED_MovingStatistics(size_t window);
+
+	/**
+	 * @fn muged_add(const muged_scalar& sample)
+	 *
+	 * Moves window by one sample
+	 *
+	 * @param sample - next sample
+	 */
+	void muged_add(const muged_scalar& sample) noexcept;
+
+	/**
+	 * @fn muged_reset()
+	 *
+	 * Removes all samples from window
+	 */
+	void muged_reset() noexcept;
+
+	/**
+	 * @fn muged_window() const
+	 *
+	 * @return size_t - window length
+	 */
+	size_t muged_window() const noexcept;
+
+	/**
+	 * @fn muged_count() const
+	 *
+	 * @return size_t - number of samples in window, less than window length until it is full
+	 */
+	size_t muged_count() const noexcept;
+
+	/**
+	 * @fn muged_mean() const
+	 *
+	 * @return muged_scalar - mean of window
+	 */
+	muged_scalar muged_mean() const noexcept;
+
+	/**
+	 * @fn muged_mean_square() const
+	 *
+	 * @return muged_scalar - mean square of window
+	 */
+	muged_scalar muged_mean_square() const noexcept;
+
+	/**
+	 * @fn muged_root_mean_square() const
+	 *
+	 * @return muged_scalar - RMS of window
+	 */
+	muged_scalar muged_root_mean_square() const noexcept;
+
+	/**
+	 * @fn muged_standard_deviation() const
+	 *
+	 * @return muged_scalar - standard deviation of window
+	 */
+	muged_scalar muged_standard_deviation() const noexcept;
+
+	/**
+	 * @fn muged_mean_into(const muged_array& input, muged_array& output)
+	 *
+	 * @param input - next block of samples
+	 * @param output - moving mean, at least input.length samples
+	 * @return size_t - number of output samples
+	 */
+	size_t muged_mean_into(const muged_array& input, muged_array& output);
+
+	/**
+	 * @fn muged_mean_square_into(const muged_array& input, muged_array& output)
+	 *
+	 * @param input - next block of samples
+	 * @param output - moving mean square, at least input.length samples
+	 * @return size_t - number of output samples
+	 */
+	size_t muged_mean_square_into(const muged_array& input, muged_array& output);
+
+	/**
+	 * @fn muged_root_mean_square_into(const muged_array& input, muged_array& output)
+	 *
+	 * @param input - next block of samples
+	 * @param output - moving RMS, at least input.length samples
+	 * @return size_t - number of output samples
+	 */
+	size_t muged_root_mean_square_into(const muged_array& input, muged_array& output);
+
+	/**
+	 * @fn muged_standard_deviation_into(const muged_array& input, muged_array& output)
+	 *
+	 * @param input - next block of samples
+	 * @param output - moving standard deviation, at least input.length samples
+	 * @return size_t - number of output samples
+	 */
+	size_t muged_standard_deviation_into(const muged_array& input, muged_array& output);
+
+private:
+
+	MUGED_MovingStatistics(const MUGED_MovingStatistics& statistics);
+	MUGED_MovingStatistics& operator=(const MUGED_MovingStatistics& statistics);
+
+	/**
+	 * @fn muged_process(const muged_array& input, muged_array& output, muged_scalar (MUGED_MovingStatistics::*statistic)() const)
+	 *
+	 * Adds block of samples and writes statistic after every one of them
+	 */
+	size_t muged_process(const muged_array& input, muged_array& output,
+	                     muged_scalar (MUGED_MovingStatistics::*statistic)() const);
+
+	/**
+	 * @fn muged_resum()
+	 *
+	 * Calculates sums again from samples of window
+	 */
+	void muged_resum() noexcept;
+
+	/// Last samples, oldest one at position when window is full
+	MUGED_Array samples;
+	size_t position;
+	size_t count;
+
+	/// Shift of samples, mean of window at last resum
+	double shift_real;
+	double shift_imag;
+
+	/// Sums of a, b, a^2, b^2 and ab of deviations a + bi of samples from shift
+	double real;
+	double imag;
+	double real_real;
+	double imag_imag;
+	double real_imag;
+};
+
+#endif /* _MUGED_MOVINGSTATISTICS_H_ */
@@ -0,0 +1,53 @@
+/**
+ * @file MUGED_Parallel.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains helpers distributing independent work across threads
+ */
+
+#ifndef _MUGED_PARALLEL_H_
+#define _MUGED_PARALLEL_H_
+
+#include <functional>
+
+#include "MUGED_Definitions.h"
+
+/**
+ * @typedef muged_parallel_body
+ * @brief Work on range of indices [begin, end)
+ */
+typedef std::function<void (size_t begin, size_t end)> muged_parallel_body;
+
+/**
+ * @fn muged_thread_count()
+ *
+ * @return size_t - number of threads used by parallel algorithms
+ *                  (number of hardware threads unless changed)
+ */
+size_t muged_thread_count();
+
+/**
+ * @fn muged_set_thread_count(size_t count)
+ *
+ * Sets number of threads used by parallel algorithms
+ *
+ * @param count - number of threads, 0 restores number of hardware threads
+ */
+void muged_set_thread_count(size_t count);
+
+/**
+ * @fn muged_parallel_for(size_t count, const muged_parallel_body& body)
+ *
+ * Splits indices 0..count-1 into contiguous ranges, one per thread, and runs body
+ * on each of them using pool of worker threads and calling thread. Returns after
+ * all ranges are done. Exception thrown by body is rethrown in calling thread.
+ * Loop nested in body of other loop, or started while pool runs loop of other
+ * thread, is processed by calling thread alone.
+ *
+ * @param count - number of indices
+ * @param body - work on range of indices
+ */
+void muged_parallel_for(size_t count, const muged_parallel_body& body);
+
+#endif /* _MUGED_PARALLEL_H_ */
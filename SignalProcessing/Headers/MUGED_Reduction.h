@@ -0,0 +1,100 @@
+/**
+ * @file MUGED_Reduction.h
+ * @date 2026-10-18
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains deterministic parallel reductions of long arrays
+ */
+
+#ifndef _MUGED_REDUCTION_H_
+#define _MUGED_REDUCTION_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Parallel.h"
+
+/**
+ * @fn muged_reduction_chunks(size_t length)
+ *
+ * @param length - number of values
+ * @return size_t - number of partial results of muged_pairwise_reduce (at least 1)
+ */
+inline size_t muged_reduction_chunks(size_t length)
+{
+	return length > 0 ? (length + MUGED_REDUCTION_CHUNK - 1) / MUGED_REDUCTION_CHUNK : 1;
+}
+
+/**
+ * @fn muged_pairwise_combine(T* partials, size_t count, const Combine& combine)
+ *
+ * Adds partial results pairwise, neighbours first, result is in partials[0]
+ *
+ * @param partials - partial results, overwritten
+ * @param count - number of partial results (at least 1)
+ * @param combine - combine(partial, other) adds other partial result to partial
+ */
+template <class T, class Combine>
+void muged_pairwise_combine(T* partials, size_t count, const Combine& combine)
+{
+	for (size_t step = 1; step < count; step *= 2)
+	{
+		for (size_t i = 0; i + step < count; i += 2 * step)
+			combine(partials[i], partials[i + step]);
+	}
+}
+
+/**
+ * @fn muged_pairwise_reduce(size_t length, T* partials, const Reduce& reduce, const Combine& combine)
+ *
+ * Reduces values in leaves of MUGED_REDUCTION_LEAF and adds their results
+ * pairwise (tree of neighbours). Chunks of MUGED_REDUCTION_CHUNK values are
+ * reduced in parallel for long arrays. Rounding error grows with logarithm of
+ * length instead of length, and order of additions doesn't depend on number
+ * of threads, so result is the same for every thread count.
+ *
+ * @param length - number of values
+ * @param partials - memory for muged_reduction_chunks(length) partial results
+ * @param reduce - reduce(begin, count, partial) reduces count values from begin
+ * @param combine - combine(partial, other) adds other partial result to partial
+ * @return T - result
+ */
+template <class T, class Reduce, class Combine>
+T muged_pairwise_reduce(size_t length, T* partials, const Reduce& reduce, const Combine& combine)
+{
+	size_t chunks = muged_reduction_chunks(length);
+
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		T leaves[MUGED_REDUCTION_CHUNK / MUGED_REDUCTION_LEAF];
+
+		for (size_t c = begin; c < end; c++)
+		{
+			size_t first = c * MUGED_REDUCTION_CHUNK;
+			size_t count = length - first < MUGED_REDUCTION_CHUNK ? length - first : MUGED_REDUCTION_CHUNK;
+
+			//Empty array still has one (empty) leaf
+			size_t leaf = 0;
+			do
+			{
+				size_t offset = leaf * MUGED_REDUCTION_LEAF;
+				reduce(first + offset, count - offset < MUGED_REDUCTION_LEAF ? count - offset : MUGED_REDUCTION_LEAF,
+				       leaves[leaf]);
+				leaf++;
+			}
+			while (leaf * MUGED_REDUCTION_LEAF < count);
+
+			muged_pairwise_combine(leaves, leaf, combine);
+			partials[c] = leaves[0];
+		}
+	};
+
+	if (length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(chunks, body);
+	else
+		body(0, chunks);
+
+	muged_pairwise_combine(partials, chunks, combine);
+
+	return partials[0];
+}
+
+#endif /* _MUGED_REDUCTION_H_ */
@@ -0,0 +1,224 @@
+/**
+ * @file MUGED_SIMD.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains vectorized kernels (FFT, sample conversion, reductions) selected at runtime
+ */
+
+#ifndef _MUGED_SIMD_H_
+#define _MUGED_SIMD_H_
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @enum MUGED_SIMDLevel
+ * @brief Instruction set used by vectorized kernels
+ */
+enum MUGED_SIMDLevel
+{
+	/// Portable C++
+	MUGED_SIMD_SCALAR,
+
+	/// SSE2, one complex value per register
+	MUGED_SIMD_SSE2,
+
+	/// AVX2 and FMA, two complex values per register
+	MUGED_SIMD_AVX2,
+
+	/// AVX-512F, four complex values per register
+	MUGED_SIMD_AVX512
+};
+
+/**
+ * @typedef muged_radix_2_stage_kernel
+ * @brief Radix-2 stage - butterflies of every block of 2*half samples
+ *
+ * @param data - samples transformed in place
+ * @param length - number of samples
+ * @param half - half of block size
+ * @param twiddles - half twiddle factors of the stage
+ */
+typedef void (*muged_radix_2_stage_kernel)(muged_scalar* data, size_t length, size_t half,
+                                           const muged_scalar* twiddles);
+
+/**
+ * @typedef muged_radix_4_pass_kernel
+ * @brief Radix-4 pass - two radix-2 stages of blocks of 4*quarter samples at once
+ *
+ * For bit-reversed samples x0..x3 (quarter apart) and w = e^(direction*2πi/4h):
+ * t = w^2j*x1, p = w^j*x2, q = w^3j*x3,
+ * y0 = x0 + t + (p + q), y2 = x0 + t - (p + q),
+ * y1 = x0 - t + direction*i*(p - q), y3 = x0 - t - direction*i*(p - q)
+ *
+ * @param data - samples transformed in place
+ * @param length - number of samples
+ * @param quarter - quarter of block size (h)
+ * @param twiddles - w^j, w^2j and w^3j of the pass (3*quarter values)
+ * @param direction - sign of twiddle exponent
+ */
+typedef void (*muged_radix_4_pass_kernel)(muged_scalar* data, size_t length, size_t quarter,
+                                          const muged_scalar* twiddles, double direction);
+
+/**
+ * @typedef muged_deinterleave_kernel
+ * @brief Splits complex samples into real and imaginary parts
+ *
+ * @param input - complex samples
+ * @param length - number of samples
+ * @param real - result, real parts
+ * @param imag - result, imaginary parts (NULL - imaginary parts are dropped)
+ */
+typedef void (*muged_deinterleave_kernel)(const muged_scalar* input, size_t length, double* real, double* imag);
+
+/**
+ * @typedef muged_interleave_kernel
+ * @brief Joins real and imaginary parts into complex samples
+ *
+ * @param real - real parts
+ * @param imag - imaginary parts (NULL - zero)
+ * @param length - number of samples
+ * @param output - result, complex samples
+ */
+typedef void (*muged_interleave_kernel)(const double* real, const double* imag, size_t length, muged_scalar* output);
+
+/**
+ * @typedef muged_sum_kernel
+ * @brief Sum of values (several partial sums, so rounding differs from sequential sum)
+ *
+ * @param values - values
+ * @param length - number of values
+ * @return double - sum
+ */
+typedef double (*muged_sum_kernel)(const double* values, size_t length);
+
+/**
+ * @typedef muged_dot_kernel
+ * @brief Dot product of two vectors (several partial sums)
+ *
+ * @param first - first vector
+ * @param second - second vector
+ * @param length - number of values
+ * @return double - sum of first[i]*second[i]
+ */
+typedef double (*muged_dot_kernel)(const double* first, const double* second, size_t length);
+
+/**
+ * @struct _muged_moments_
+ * Sums over complex samples z = a + bi, from which statistics are calculated
+ */
+struct _muged_moments_
+{
+	/// Sum of a and sum of b
+	double real;
+	double imag;
+
+	/// Sums of a^2, b^2 and ab
+	double real_real;
+	double imag_imag;
+	double real_imag;
+
+	/// Smallest and largest |z|^2 (HUGE_VAL and 0 for no samples)
+	double min_norm;
+	double max_norm;
+};
+
+/**
+ * @typedef muged_moments
+ * @brief Sums over complex samples
+ */
+typedef _muged_moments_ muged_moments;
+
+/**
+ * @typedef muged_moments_kernel
+ * @brief All sums over complex samples in one pass (several partial sums)
+ *
+ * @param samples - complex samples
+ * @param length - number of samples
+ * @param moments - result
+ */
+typedef void (*muged_moments_kernel)(const muged_scalar* samples, size_t length, muged_moments& moments);
+
+/**
+ * @fn muged_simd_supported()
+ *
+ * Detects the best instruction set of current CPU (CPUID)
+ *
+ * @return MUGED_SIMDLevel - supported instruction set
+ */
+MUGED_SIMDLevel muged_simd_supported();
+
+/**
+ * @fn muged_simd_level()
+ *
+ * @return MUGED_SIMDLevel - instruction set used by kernels
+ */
+MUGED_SIMDLevel muged_simd_level();
+
+/**
+ * @fn muged_set_simd_level(MUGED_SIMDLevel level)
+ *
+ * Limits instruction set used by kernels, e.g. to compare results of all paths.
+ * Level above muged_simd_supported() is lowered.
+ *
+ * @param level - instruction set
+ */
+void muged_set_simd_level(MUGED_SIMDLevel level);
+
+/**
+ * @fn muged_radix_2_stage(size_t half)
+ *
+ * Returns radix-2 stage kernel for used instruction set and block size
+ *
+ * @param half - half of block size
+ * @return muged_radix_2_stage_kernel - kernel
+ */
+muged_radix_2_stage_kernel muged_radix_2_stage(size_t half);
+
+/**
+ * @fn muged_radix_4_pass(size_t quarter)
+ *
+ * Returns radix-4 pass kernel for used instruction set and block size
+ *
+ * @param quarter - quarter of block size
+ * @return muged_radix_4_pass_kernel - kernel
+ */
+muged_radix_4_pass_kernel muged_radix_4_pass(size_t quarter);
+
+/**
+ * @fn muged_deinterleave()
+ *
+ * @return muged_deinterleave_kernel - kernel for used instruction set
+ */
+muged_deinterleave_kernel muged_deinterleave();
+
+/**
+ * @fn muged_interleave()
+ *
+ * @return muged_interleave_kernel - kernel for used instruction set
+ */
+muged_interleave_kernel muged_interleave();
+
+/**
+ * @fn muged_sum()
+ *
+ * @return muged_sum_kernel - kernel for used instruction set
+ */
+muged_sum_kernel muged_sum();
+
+/**
+ * @fn muged_dot()
+ *
+ * @return muged_dot_kernel - kernel for used instruction set
+ */
+muged_dot_kernel muged_dot();
+
+/**
+ * @fn muged_moments_sum()
+ *
+ * @return muged_moments_kernel - kernel for used instruction set
+ */
+muged_moments_kernel muged_moments_sum();
+
+#endif /* _MUGED_SIMD_H_ */
@@ -0,0 +1,183 @@
+/**
+ * @file MUGED_SampleView.h
+ * @date 2026-10-17
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains non-owning views of samples in foreign formats
+ */
+
+#ifndef _MUGED_SAMPLEVIEW_H_
+#define _MUGED_SAMPLEVIEW_H_
+
+#include <algorithm>
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @enum MUGED_SampleFormat
+ * @brief Layout of samples wrapped by MUGED_SampleView
+ */
+enum MUGED_SampleFormat
+{
+	/// MUGED_Complex samples (muged_array)
+	MUGED_SAMPLE_COMPLEX,
+
+	/// Real double samples
+	MUGED_SAMPLE_REAL,
+
+	/// Interleaved float I/Q pairs (real, imaginary)
+	MUGED_SAMPLE_FLOAT_IQ,
+
+	/// Interleaved int16 I/Q pairs multiplied by scale, e.g. ADC output
+	MUGED_SAMPLE_INT16_IQ
+};
+
+/**
+ * @class MUGED_SampleView
+ * @author Kamil Sorokosz
+ * @brief Non-owning view of complex samples stored in foreign format
+ *
+ * View wraps memory of caller (e.g. driver buffer) without copying it. MUGED_DSP
+ * statistics, correlation and FFT accept views directly and convert samples
+ * while reading them.
+ */
+class MUGED_SampleView
+{
+public:
+
+	/**
+	 * @fn MUGED_SampleView(const muged_array& signal)
+	 *
+	 * @param signal - complex samples
+	 */
+	explicit MUGED_SampleView(const muged_array& signal) noexcept
+		: data(signal.array), length(signal.length), format(MUGED_SAMPLE_COMPLEX), scale(1)
+	{
+	}
+
+	/**
+	 * @fn MUGED_SampleView(const muged_real_array& signal)
+	 *
+	 * @param signal - real samples
+	 */
+	explicit MUGED_SampleView(const muged_real_array& signal) noexcept
+		: data(signal.array), length(signal.length), format(MUGED_SAMPLE_REAL), scale(1)
+	{
+	}
+
+	/**
+	 * @fn MUGED_SampleView(const double* samples, size_t length)
+	 *
+	 * @param samples - real samples
+	 * @param length - number of samples
+	 */
+	MUGED_SampleView(const double* samples, size_t length) noexcept
+		: data(samples), length(length), format(MUGED_SAMPLE_REAL), scale(1)
+	{
+	}
+
+	/**
+	 * @fn MUGED_SampleView(const float* iq, size_t length)
+	 *
+	 * @param iq - interleaved real and imaginary parts, 2*length floats
+	 * @param length - number of complex samples
+	 */
+	MUGED_SampleView(const float* iq, size_t length) noexcept
+		: data(iq), length(length), format(MUGED_SAMPLE_FLOAT_IQ), scale(1)
+	{
+	}
+
+	/**
+	 * @fn MUGED_SampleView(const int16_t* iq, size_t length, double scale)
+	 *
+	 * @param iq - interleaved real and imaginary parts, 2*length integers
+	 * @param length - number of complex samples
+	 * @param scale - value of one unit, e.g. 1/32768 for full scale 1
+	 */
+	MUGED_SampleView(const int16_t* iq, size_t length, double scale) noexcept
+		: data(iq), length(length), format(MUGED_SAMPLE_INT16_IQ), scale(scale)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->length;
+	}
+
+	MUGED_SampleFormat muged_format() const noexcept
+	{
+		return this->format;
+	}
+
+	double muged_scale() const noexcept
+	{
+		return this->scale;
+	}
+
+	const void* muged_data() const noexcept
+	{
+		return this->data;
+	}
+
+	/**
+	 * @fn operator[](size_t i) const
+	 *
+	 * @param i - index of sample
+	 * @return muged_scalar - converted sample (use muged_convert for many samples)
+	 */
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		muged_scalar sample;
+		muged_convert(i, 1, &sample);
+		return sample;
+	}
+
+	/**
+	 * @fn muged_convert(size_t begin, size_t count, muged_scalar* output) const
+	 *
+	 * Converts range of samples, loop of every format is vectorized by compiler
+	 *
+	 * @param begin - first sample
+	 * @param count - number of samples
+	 * @param output - result, count samples
+	 */
+	void muged_convert(size_t begin, size_t count, muged_scalar* output) const noexcept
+	{
+		double* result = muged_as_doubles(output);
+
+		switch (this->format)
+		{
+		case MUGED_SAMPLE_COMPLEX:
+			std::copy((const muged_scalar*)this->data + begin, (const muged_scalar*)this->data + begin + count, output);
+			break;
+
+		case MUGED_SAMPLE_REAL:
+			for (size_t i = 0; i < count; i++)
+			{
+				result[2 * i] = ((const double*)this->data)[begin + i];
+				result[2 * i + 1] = 0;
+			}
+			break;
+
+		case MUGED_SAMPLE_FLOAT_IQ:
+			for (size_t i = 0; i < 2 * count; i++)
+				result[i] = ((const float*)this->data)[2 * begin + i];
+			break;
+
+		case MUGED_SAMPLE_INT16_IQ:
+			for (size_t i = 0; i < 2 * count; i++)
+				result[i] = ((const int16_t*)this->data)[2 * begin + i] * this->scale;
+			break;
+		}
+	}
+
+private:
+
+	const void* data;
+	size_t length;
+	MUGED_SampleFormat format;
+	double scale;
+};
+
+#endif /* _MUGED_SAMPLEVIEW_H_ */
@@ -0,0 +1,282 @@
+/**
+ * @file MUGED_Sketch.h
+ * @date 2026-10-18
+ * @author Kamil Sorokosz
+ *
+ * @brief File contains streaming sketches of amplitude distribution (quantiles, histogram)
+ */
+
+#ifndef _MUGED_SKETCH_H_
+#define _MUGED_SKETCH_H_
+
+#include <vector>
+
+#include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
+
+/**
+ * @struct _muged_centroid_
+ * Mean of group of values and their number
+ */
+struct _muged_centroid_
+{
+	double mean;
+	double weight;
+};
+
+/**
+ * @typedef muged_centroid
+ * @brief Group of values of quantile sketch
+ */
+typedef _muged_centroid_ muged_centroid;
+
+/**
+ * @class MUGED_QuantileSketch
+ * @author Kamil Sorokosz
+ * @brief Approximate quantiles of magnitudes |x| of stream of samples (t-digest)
+ *
+ * Sketch keeps sorted centroids - means of neighbouring values and their
+ * number. Centroid may hold more values in the middle of distribution than
+ * near its ends (scale function k(q) = compression/2π * asin(2q - 1)), so
+ * tail quantiles like p99.9 stay accurate. New values are collected in buffer
+ * and merged with centroids when it is full. Memory is fixed by compression
+ * and doesn't grow with number of samples. Sketches of parts of stream (e.g.
+ * of threads) can be merged.
+ */
+class MUGED_QuantileSketch
+{
+public:
+
+	/**
+	 * @fn MUGED_QuantileSketch(double compression)
+	 *
+	 * @param compression - accuracy, about compression centroids are kept
+	 *                      (ERR_SKETCH_COMPRESSION is thrown below 1)
+	 */
+	explicit MUGED_QuantileSketch(double compression = MUGED_SKETCH_COMPRESSION);
+
+	/**
+	 * @fn muged_add(const muged_scalar& sample)
+	 *
+	 * @param sample - next sample, its magnitude is added
+	 */
+	void muged_add(const muged_scalar& sample);
+
+	/**
+	 * @fn muged_add(const muged_array& signal)
+	 *
+	 * @param signal - next block of samples, magnitudes are calculated by vector kernel
+	 */
+	void muged_add(const muged_array& signal);
+
+	/**
+	 * @fn muged_merge(const MUGED_QuantileSketch& sketch)
+	 *
+	 * Adds values of other sketch
+	 *
+	 * @param sketch - partial sketch
+	 */
+	void muged_merge(const MUGED_QuantileSketch& sketch);
+
+	/**
+	 * @fn muged_quantile(double q)
+	 *
+	 * Merges buffered values and estimates quantile
+	 *
+	 * @param q - quantile, 0..1 (e.g. 0.99 for p99)
+	 * @return double - magnitude, 0 for empty sketch
+	 */
+	double muged_quantile(double q);
+
+	/**
+	 * @fn muged_reset()
+	 *
+	 * Removes all values
+	 */
+	void muged_reset();
+
+	/**
+	 * @fn muged_count() const
+	 *
+	 * @return size_t - number of values added
+	 */
+	size_t muged_count() const;
+
+	/**
+	 * @fn muged_minimum() const
+	 *
+	 * @return double - smallest magnitude, 0 for empty sketch
+	 */
+	double muged_minimum() const;
+
+	/**
+	 * @fn muged_maximum() const
+	 *
+	 * @return double - largest magnitude, 0 for empty sketch
+	 */
+	double muged_maximum() const;
+
+	/**
+	 * @fn muged_centroids()
+	 *
+	 * Merges buffered values
+	 *
+	 * @return size_t - number of centroids
+	 */
+	size_t muged_centroids();
+
+private:
+
+	/**
+	 * @fn muged_add_centroid(double mean, double weight)
+	 *
+	 * Adds value or centroid of other sketch into buffer
+	 */
+	void muged_add_centroid(double mean, double weight);
+
+	/**
+	 * @fn muged_compress()
+	 *
+	 * Merges buffer with centroids
+	 */
+	void muged_compress();
+
+	double compression;
+
+	/// Sorted centroids and unsorted buffer, merged when it has limit values
+	std::vector<muged_centroid> centroids;
+	std::vector<muged_centroid> buffer;
+	size_t limit;
+
+	size_t count;
+	double minimum;
+	double maximum;
+};
+
+/**
+ * @class MUGED_Histogram
+ * @author Kamil Sorokosz
+ * @brief Histogram of magnitudes |x| of stream of samples with equal bins
+ *
+ * Bins divide range [minimum, maximum) equally, magnitudes outside of it are
+ * counted as underflow and overflow. Histograms with the same bins can be merged.
+ */
+class MUGED_Histogram
+{
+public:
+
+	/**
+	 * @fn MUGED_Histogram(double minimum, double maximum, size_t bins)
+	 *
+	 * @param minimum - lower edge of first bin
+	 * @param maximum - upper edge of last bin
+	 * @param bins - number of bins (ERR_HISTOGRAM_RANGE is thrown for 0 or maximum <= minimum)
+	 */
+	MUGED_Histogram(double minimum, double maximum, size_t bins);
+
+	/**
+	 * @fn muged_add(const muged_scalar& sample)
+	 *
+	 * @param sample - next sample, its magnitude is counted
+	 */
+	void muged_add(const muged_scalar& sample);
+
+	/**
+	 * @fn muged_add(const muged_array& signal)
+	 *
+	 * @param signal - next block of samples, magnitudes are calculated by vector kernel
+	 */
+	void muged_add(const muged_array& signal);
+
+	/**
+	 * @fn muged_merge(const MUGED_Histogram& histogram)
+	 *
+	 * Adds counts of other histogram (ERR_HISTOGRAM_LAYOUT is thrown for different bins)
+	 *
+	 * @param histogram - partial histogram
+	 */
+	void muged_merge(const MUGED_Histogram& histogram);
+
+	/**
+	 * @fn muged_reset()
+	 *
+	 * Sets all counts to 0
+	 */
+	void muged_reset();
+
+	/**
+	 * @fn muged_bins() const
+	 *
+	 * @return size_t - number of bins
+	 */
+	size_t muged_bins() const;
+
+	/**
+	 * @fn muged_edge(size_t bin) const
+	 *
+	 * @param bin - index of bin, muged_bins() gives upper edge of last bin
+	 * @return double - lower edge of bin
+	 */
+	double muged_edge(size_t bin) const;
+
+	/**
+	 * @fn muged_count(size_t bin) const
+	 *
+	 * @param bin - index of bin
+	 * @return size_t - number of magnitudes in bin
+	 */
+	size_t muged_count(size_t bin) const;
+
+	/**
+	 * @fn muged_underflow() const
+	 *
+	 * @return size_t - number of magnitudes below minimum (also NaN)
+	 */
+	size_t muged_underflow() const;
+
+	/**
+	 * @fn muged_overflow() const
+	 *
+	 * @return size_t - number of magnitudes at or above maximum
+	 */
+	size_t muged_overflow() const;
+
+	/**
+	 * @fn muged_total() const
+	 *
+	 * @return size_t - number of all magnitudes
+	 */
+	size_t muged_total() const;
+
+	/**
+	 * @fn muged_quantile(double q) const
+	 *
+	 * Estimates quantile by linear interpolation inside of bin, underflow and
+	 * overflow give minimum and maximum
+	 *
+	 * @param q - quantile, 0..1
+	 * @return double - magnitude, minimum for empty histogram
+	 */
+	double muged_quantile(double q) const;
+
+private:
+
+	/**
+	 * @fn muged_count_magnitudes(const double* magnitudes, size_t length)
+	 *
+	 * Adds magnitudes into bins
+	 */
+	void muged_count_magnitudes(const double* magnitudes, size_t length);
+
+	double minimum;
+	double maximum;
+
+	/// Bins per unit of magnitude
+	double scale;
+
+	std::vector<size_t> counts;
+	size_t underflow;
+	size_t overflow;
+};
+
+#endif /* _MUGED_SKETCH_H_ */
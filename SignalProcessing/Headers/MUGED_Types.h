@@ -28,6 +28,29 @@ struct _muged_array_
 	size_t length;
 };
 
+/**
+ * @struct _muged_real_array_
+ * Array for real samples - 1D real signal
+ */
+struct _muged_real_array_
+{
+	double* array;
+	size_t length;
+};
+
+/**
+ * @struct _muged_split_array_
+ * Array of complex samples stored as separate real and imaginary parts
+ * (structure of arrays). imag equal to NULL means real signal - every
+ * imaginary part is zero and isn't stored.
+ */
+struct _muged_split_array_
+{
+	double* real;
+	double* imag;
+	size_t length;
+};
+
 /**
  * @struct _muged_matrix_
  * 2D array for 2D signals
@@ -39,18 +62,54 @@ struct _muged_matrix_
 	size_t cols;
 };
 
+/**
+ * @struct _muged_statistics_
+ * Statistics of 1D signal calculated together in one pass
+ */
+struct _muged_statistics_
+{
+	muged_scalar mean;
+	muged_scalar mean_square;
+	muged_scalar root_mean_square;
+	muged_scalar standard_deviation;
+
+	/// Smallest and largest magnitude |x| (0 for empty signal)
+	double minimum;
+	double maximum;
+
+	size_t length;
+};
+
 /**
  * @typedef muged_array
  * @brief 1D array type
  */
 typedef _muged_array_  muged_array;
 
+/**
+ * @typedef muged_real_array
+ * @brief 1D real array type
+ */
+typedef _muged_real_array_ muged_real_array;
+
+/**
+ * @typedef muged_split_array
+ * @brief 1D split-complex array type
+ */
+typedef _muged_split_array_ muged_split_array;
+
 /**
  * @typedef muged_matrix
  * @brief 2D array type
  */
 typedef _muged_matrix_ muged_matrix;
 
+/**
+ * @typedef muged_statistics
+ * @brief Statistics of 1D signal
+ */
+typedef _muged_statistics_ muged_statistics;
+
 /**
  * @class MUGED_DSPException
  *
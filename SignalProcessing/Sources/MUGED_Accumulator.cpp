@@ -0,0 +1,183 @@
+#include "MUGED_Accumulator.h"
+
+/// Samples of view converted at once
+#define MUGED_ACCUMULATOR_BLOCK 256
+
+MUGED_Accumulator::MUGED_Accumulator() noexcept
+{
+	muged_reset();
+}
+
+void MUGED_Accumulator::muged_add(const muged_scalar& sample) noexcept
+{
+	double a = sample.muged_real();
+	double b = sample.muged_imag();
+	double norm = a * a + b * b;
+
+	//Welford - deviations before and after mean update
+	this->count++;
+	double delta_real = a - this->mean_real;
+	double delta_imag = b - this->mean_imag;
+	this->mean_real += delta_real / this->count;
+	this->mean_imag += delta_imag / this->count;
+
+	this->real_real += delta_real * (a - this->mean_real);
+	this->imag_imag += delta_imag * (b - this->mean_imag);
+	this->real_imag += delta_real * (b - this->mean_imag);
+
+	if (norm < this->min_norm)
+		this->min_norm = norm;
+	if (norm > this->max_norm)
+		this->max_norm = norm;
+}
+
+void MUGED_Accumulator::muged_add(const muged_array& signal) noexcept
+{
+	if (signal.length == 0)
+		return;
+
+	//Sums around shift close to mean don't cancel, first block uses its first sample
+	const double* values = muged_as_doubles(signal.array);
+	double shift_real = this->count > 0 ? this->mean_real : values[0];
+	double shift_imag = this->count > 0 ? this->mean_imag : values[1];
+
+	double sum_real = 0, sum_imag = 0, sum_real_real = 0, sum_imag_imag = 0, sum_real_imag = 0;
+
+	for (size_t i = 0; i < signal.length; i++)
+	{
+		double a = values[2 * i] - shift_real;
+		double b = values[2 * i + 1] - shift_imag;
+		double norm = values[2 * i] * values[2 * i] + values[2 * i + 1] * values[2 * i + 1];
+
+		sum_real += a;
+		sum_imag += b;
+		sum_real_real += a * a;
+		sum_imag_imag += b * b;
+		sum_real_imag += a * b;
+
+		if (norm < this->min_norm)
+			this->min_norm = norm;
+		if (norm > this->max_norm)
+			this->max_norm = norm;
+	}
+
+	//Moments of block around its own mean
+	double count = signal.length;
+	muged_join(count, shift_real + sum_real / count, shift_imag + sum_imag / count,
+	           sum_real_real - sum_real * sum_real / count,
+	           sum_imag_imag - sum_imag * sum_imag / count,
+	           sum_real_imag - sum_real * sum_imag / count);
+}
+
+void MUGED_Accumulator::muged_add(const MUGED_SampleView& signal) noexcept
+{
+	muged_scalar buffer[MUGED_ACCUMULATOR_BLOCK];
+
+	muged_array block;
+	block.array = buffer;
+
+	for (size_t begin = 0; begin < signal.muged_length(); begin += MUGED_ACCUMULATOR_BLOCK)
+	{
+		block.length = signal.muged_length() - begin;
+		if (block.length > MUGED_ACCUMULATOR_BLOCK)
+			block.length = MUGED_ACCUMULATOR_BLOCK;
+
+		signal.muged_convert(begin, block.length, buffer);
+		muged_add(block);
+	}
+}
+
+void MUGED_Accumulator::muged_merge(const MUGED_Accumulator& accumulator) noexcept
+{
+	if (accumulator.count == 0)
+		return;
+
+	if (accumulator.min_norm < this->min_norm)
+		this->min_norm = accumulator.min_norm;
+	if (accumulator.max_norm > this->max_norm)
+		this->max_norm = accumulator.max_norm;
+
+	muged_join(accumulator.count, accumulator.mean_real, accumulator.mean_imag,
+	           accumulator.real_real, accumulator.imag_imag, accumulator.real_imag);
+}
+
+void MUGED_Accumulator::muged_join(double count, double mean_real, double mean_imag,
+                                   double real_real, double imag_imag, double real_imag) noexcept
+{
+	double own = this->count;
+	double total = own + count;
+
+	double delta_real = mean_real - this->mean_real;
+	double delta_imag = mean_imag - this->mean_imag;
+	double weight = own * count / total;
+
+	this->mean_real += delta_real * count / total;
+	this->mean_imag += delta_imag * count / total;
+
+	this->real_real += real_real + delta_real * delta_real * weight;
+	this->imag_imag += imag_imag + delta_imag * delta_imag * weight;
+	this->real_imag += real_imag + delta_real * delta_imag * weight;
+
+	this->count += (size_t)count;
+}
+
+void MUGED_Accumulator::muged_reset() noexcept
+{
+	this->count = 0;
+	this->mean_real = 0;
+	this->mean_imag = 0;
+	this->real_real = 0;
+	this->imag_imag = 0;
+	this->real_imag = 0;
+	this->min_norm = HUGE_VAL;
+	this->max_norm = 0;
+}
+
+size_t MUGED_Accumulator::muged_count() const noexcept
+{
+	return this->count;
+}
+
+muged_scalar MUGED_Accumulator::muged_mean() const noexcept
+{
+	return muged_scalar(this->mean_real, this->mean_imag);
+}
+
+muged_scalar MUGED_Accumulator::muged_mean_square() const noexcept
+{
+	//E[z^2] = (E[a^2] - E[b^2]) + 2E[ab]i, E[a^2] = var(a) + mean(a)^2
+	double real = (this->real_real - this->imag_imag) / this->count
+	              + this->mean_real * this->mean_real - this->mean_imag * this->mean_imag;
+	double imag = 2 * (this->real_imag / this->count + this->mean_real * this->mean_imag);
+
+	return muged_scalar(real, imag);
+}
+
+muged_scalar MUGED_Accumulator::muged_root_mean_square() const noexcept
+{
+	double mean_norm = (this->real_real + this->imag_imag) / this->count
+	                   + this->mean_real * this->mean_real + this->mean_imag * this->mean_imag;
+
+	return muged_scalar(mean_norm, 0).muged_sqrt();
+}
+
+muged_scalar MUGED_Accumulator::muged_standard_deviation() const noexcept
+{
+	//E[z^2] - E[z]^2 from deviations, without cancellation
+	return muged_scalar((this->real_real - this->imag_imag) / this->count,
+	                    2 * this->real_imag / this->count).muged_sqrt();
+}
+
+muged_statistics MUGED_Accumulator::muged_snapshot() const noexcept
+{
+	muged_statistics statistics;
+	statistics.length = this->count;
+	statistics.mean = muged_mean();
+	statistics.mean_square = muged_mean_square();
+	statistics.root_mean_square = muged_root_mean_square();
+	statistics.standard_deviation = muged_standard_deviation();
+	statistics.minimum = this->count > 0 ? sqrt(this->min_norm) : 0;
+	statistics.maximum = sqrt(this->max_norm);
+
+	return statistics;
+}
@@ -0,0 +1,182 @@
+#include <new>
+
+#include "MUGED_Arena.h"
+#include "MUGED_Memory.h"
+
+MUGED_Arena::MUGED_Arena(size_t capacity)
+	: blocks(NULL), sizes(NULL), count(0), slots(0), current(0), used(0),
+	  in_use(0), peak(0), heap_allocations(0)
+{
+	if (capacity > 0)
+		muged_reserve(capacity);
+}
+
+MUGED_Arena::~MUGED_Arena()
+{
+	for (size_t i = 0; i < this->count; i++)
+		muged_aligned_free(this->blocks[i]);
+
+	delete [] this->blocks;
+	delete [] this->sizes;
+}
+
+void* MUGED_Arena::muged_allocate(size_t bytes)
+{
+	//Every allocation keeps next one aligned
+	bytes = (bytes + MUGED_ALIGNMENT - 1) / MUGED_ALIGNMENT * MUGED_ALIGNMENT;
+	if (bytes == 0)
+		bytes = MUGED_ALIGNMENT;
+
+	if (this->count == 0 || this->used + bytes > this->sizes[this->current])
+		muged_add_block(bytes);
+
+	void* memory = this->blocks[this->current] + this->used;
+
+	this->used += bytes;
+	this->in_use += bytes;
+	if (this->in_use > this->peak)
+		this->peak = this->in_use;
+
+	return memory;
+}
+
+muged_arena_mark MUGED_Arena::muged_mark() const
+{
+	muged_arena_mark mark;
+	mark.block = this->current;
+	mark.used = this->used;
+	mark.in_use = this->in_use;
+
+	return mark;
+}
+
+void MUGED_Arena::muged_release(const muged_arena_mark& mark)
+{
+	this->current = mark.block;
+	this->used = mark.used;
+	this->in_use = mark.in_use;
+
+	//Release is called by destructors, so failed coalescing just keeps blocks
+	if (this->in_use == 0 && this->count > 1)
+	{
+		try
+		{
+			muged_coalesce();
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+void MUGED_Arena::muged_reserve(size_t bytes)
+{
+	bytes = (bytes + MUGED_ALIGNMENT - 1) / MUGED_ALIGNMENT * MUGED_ALIGNMENT;
+	if (bytes > this->peak)
+		this->peak = bytes;
+
+	if (this->peak > 0 && this->in_use == 0 && (this->count != 1 || this->sizes[0] < this->peak))
+		muged_coalesce();
+}
+
+size_t MUGED_Arena::muged_in_use() const
+{
+	return this->in_use;
+}
+
+size_t MUGED_Arena::muged_peak() const
+{
+	return this->peak;
+}
+
+size_t MUGED_Arena::muged_capacity() const
+{
+	size_t capacity = 0;
+	for (size_t i = 0; i < this->count; i++)
+		capacity += this->sizes[i];
+
+	return capacity;
+}
+
+size_t MUGED_Arena::muged_heap_allocations() const
+{
+	return this->heap_allocations;
+}
+
+void MUGED_Arena::muged_reset_statistics()
+{
+	this->peak = this->in_use;
+	this->heap_allocations = 0;
+}
+
+void MUGED_Arena::muged_add_block(size_t bytes)
+{
+	size_t next = this->count > 0 ? this->current + 1 : 0;
+
+	//Block left by earlier release
+	if (next < this->count && this->sizes[next] >= bytes)
+	{
+		this->current = next;
+		this->used = 0;
+		return;
+	}
+
+	//Blocks grow geometrically, so chain stays short until it is coalesced
+	size_t size = muged_capacity();
+	if (size < bytes)
+		size = bytes;
+
+	if (next == this->slots)
+	{
+		size_t slots = this->slots > 0 ? 2 * this->slots : 4;
+		char** blocks = new char*[slots];
+		size_t* sizes = new size_t[slots];
+
+		for (size_t i = 0; i < this->count; i++)
+		{
+			blocks[i] = this->blocks[i];
+			sizes[i] = this->sizes[i];
+		}
+
+		delete [] this->blocks;
+		delete [] this->sizes;
+		this->blocks = blocks;
+		this->sizes = sizes;
+		this->slots = slots;
+	}
+
+	char* block = (char*)muged_aligned_alloc(size);
+	this->heap_allocations++;
+
+	if (next < this->count)
+		muged_aligned_free(this->blocks[next]);
+	else
+		this->count++;
+
+	this->blocks[next] = block;
+	this->sizes[next] = size;
+	this->current = next;
+	this->used = 0;
+}
+
+void MUGED_Arena::muged_coalesce()
+{
+	if (this->slots == 0)
+	{
+		this->blocks = new char*[1];
+		this->sizes = new size_t[1];
+		this->slots = 1;
+	}
+
+	char* block = (char*)muged_aligned_alloc(this->peak);
+	this->heap_allocations++;
+
+	for (size_t i = 0; i < this->count; i++)
+		muged_aligned_free(this->blocks[i]);
+
+	this->blocks[0] = block;
+	this->sizes[0] = this->peak;
+	this->count = 1;
+	this->current = 0;
+	this->used = 0;
+}
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <utility>
+#include <stdint.h>
+
+#include "MUGED_Array.h"
+
+MUGED_MatrixView::MUGED_MatrixView(const muged_matrix& matrix)
+	: data(NULL), rows(matrix.rows), cols(matrix.cols), stride(matrix.cols)
+{
+	if (!muged_strided(matrix))
+		throw new MUGED_DSPException(ERR_MATRIX_LAYOUT);
+
+	if (matrix.rows > 0)
+		this->data = matrix.matrix[0];
+	if (matrix.rows > 1)
+		this->stride = matrix.matrix[1] - matrix.matrix[0];
+}
+
+bool muged_strided(const muged_matrix& matrix)
+{
+	if (matrix.rows <= 1)
+		return true;
+
+	//Rows may be separate allocations, so addresses are compared as integers
+	uintptr_t first = (uintptr_t)matrix.matrix[0];
+	uintptr_t second = (uintptr_t)matrix.matrix[1];
+
+	//Rows follow each other forward, with no overlap
+	if (second <= first || (second - first) % sizeof(muged_scalar) != 0
+	    || (second - first) / sizeof(muged_scalar) < matrix.cols)
+		return false;
+
+	for (size_t r = 2; r < matrix.rows; r++)
+	{
+		if ((uintptr_t)matrix.matrix[r] != first + r * (second - first))
+			return false;
+	}
+
+	return true;
+}
+
+MUGED_Matrix::MUGED_Matrix() noexcept
+	: data(NULL), stride(0)
+{
+	this->view.matrix = NULL;
+	this->view.rows = 0;
+	this->view.cols = 0;
+}
+
+MUGED_Matrix::MUGED_Matrix(size_t rows, size_t cols, MUGED_Initialization initialization)
+	: data(NULL)
+{
+	//Every row starts at MUGED_ALIGNMENT bytes
+	const size_t alignment = MUGED_ALIGNMENT / sizeof(muged_scalar);
+	this->stride = (cols + alignment - 1) / alignment * alignment;
+
+	size_t length = rows * this->stride;
+
+	this->view.matrix = NULL;
+	this->view.rows = rows;
+	this->view.cols = cols;
+
+	if (length == 0)
+		return;
+
+	//Rows share one block
+	this->data = (muged_scalar*)muged_aligned_alloc(length * sizeof(muged_scalar));
+
+	try
+	{
+		this->view.matrix = new muged_scalar*[rows];
+	}
+	catch (...)
+	{
+		muged_aligned_free(this->data);
+		throw;
+	}
+
+	for (size_t r = 0; r < rows; r++)
+		this->view.matrix[r] = this->data + r * this->stride;
+
+	if (initialization == MUGED_ZERO_INITIALIZED)
+		std::fill(this->data, this->data + length, muged_scalar());
+}
+
+MUGED_Matrix::MUGED_Matrix(const muged_matrix& source)
+	: MUGED_Matrix(source.rows, source.cols, MUGED_UNINITIALIZED)
+{
+	//Rows of source may be anywhere
+	for (size_t r = 0; r < source.rows && source.cols > 0; r++)
+		std::copy(source.matrix[r], source.matrix[r] + source.cols, this->view.matrix[r]);
+}
+
+MUGED_Matrix::MUGED_Matrix(const MUGED_MatrixView& source)
+	: MUGED_Matrix(source.muged_rows(), source.muged_cols(), MUGED_UNINITIALIZED)
+{
+	for (size_t r = 0; r < source.muged_rows() && source.muged_cols() > 0; r++)
+		std::copy(source[r], source[r] + source.muged_cols(), this->view.matrix[r]);
+}
+
+MUGED_Matrix::MUGED_Matrix(MUGED_Matrix&& matrix) noexcept
+	: data(matrix.data), stride(matrix.stride), view(matrix.view)
+{
+	matrix.data = NULL;
+	matrix.stride = 0;
+	matrix.view.matrix = NULL;
+	matrix.view.rows = 0;
+	matrix.view.cols = 0;
+}
+
+MUGED_Matrix& MUGED_Matrix::operator=(MUGED_Matrix&& matrix) noexcept
+{
+	std::swap(this->data, matrix.data);
+	std::swap(this->stride, matrix.stride);
+	std::swap(this->view, matrix.view);
+	return *this;
+}
+
+MUGED_Matrix::~MUGED_Matrix()
+{
+	delete [] this->view.matrix;
+	muged_aligned_free(this->data);
+}
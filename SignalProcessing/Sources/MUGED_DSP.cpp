@@ -1,4 +1,10 @@
+#include <memory>
+#include <vector>
+
 #include "MUGED_DSP.h"
+#include "MUGED_Parallel.h"
+#include "MUGED_Reduction.h"
+#include "MUGED_SIMD.h"
 
 MUGED_DSP::MUGED_DSP()
 {
@@ -8,70 +14,201 @@ MUGED_DSP::~MUGED_DSP()
 {
 }
 
-muged_scalar MUGED_DSP::muged_mean(muged_array& signal)
+/**
+ * Statistics from sums over samples
+ */
+static muged_statistics muged_statistics_from(const muged_moments& moments, size_t length)
 {
-	size_t size = signal.length;
-	muged_scalar sum;
+	muged_statistics statistics;
+	statistics.length = length;
 
-	for (size_t i = 0; i < size; i++)
-	{
-		muged_scalar& current_scalar = signal.array[i];
-		sum += current_scalar;
-	}
+	//z^2 = (a^2 - b^2) + 2abi, |z^2| = a^2 + b^2
+	statistics.mean = muged_scalar(moments.real, moments.imag) / length;
+	statistics.mean_square = muged_scalar(moments.real_real - moments.imag_imag, 2 * moments.real_imag) / length;
+	statistics.root_mean_square = muged_scalar((moments.real_real + moments.imag_imag) / length, 0).muged_sqrt();
+	statistics.standard_deviation = ( statistics.mean_square - statistics.mean.muged_pow() ).muged_sqrt();
 
-	muged_scalar mean = sum/size;
+	statistics.minimum = length > 0 ? sqrt(moments.min_norm) : 0;
+	statistics.maximum = sqrt(moments.max_norm);
 
-	return mean;
+	return statistics;
 }
 
-muged_scalar MUGED_DSP::muged_root_mean_square(muged_array& signal)
+/**
+ * Adds sums of other samples
+ */
+static void muged_combine_moments(muged_moments& moments, const muged_moments& other)
 {
-	muged_array local_signal;
-	local_signal.array = new muged_scalar[signal.length];
-	local_signal.length = signal.length;
+	moments.real += other.real;
+	moments.imag += other.imag;
+	moments.real_real += other.real_real;
+	moments.imag_imag += other.imag_imag;
+	moments.real_imag += other.real_imag;
+
+	if (other.min_norm < moments.min_norm)
+		moments.min_norm = other.min_norm;
+	if (other.max_norm > moments.max_norm)
+		moments.max_norm = other.max_norm;
+}
 
-	for (unsigned int i = 0; i < signal.length; i++)
-	{
-		muged_scalar& current_scalar = signal.array[i];
-		muged_scalar square_scalar = current_scalar.muged_pow();
-		muged_scalar square_abs_scalar = muged_scalar(square_scalar.muged_abs(),0,false);
+/**
+ * Sum of values in chunks added pairwise
+ */
+static double muged_chunked_sum(MUGED_Arena& arena, const double* values, size_t length)
+{
+	MUGED_ArenaScope scope(arena);
 
-		local_signal.array[i] = square_abs_scalar;
-	}
+	double* partials = arena.muged_allocate<double>(muged_reduction_chunks(length));
+	muged_sum_kernel sum = muged_sum();
+
+	return muged_pairwise_reduce(length, partials,
+		[values, sum](size_t begin, size_t count, double& partial)
+		{
+			partial = sum(values + begin, count);
+		},
+		[](double& partial, const double& other)
+		{
+			partial += other;
+		});
+}
+
+/**
+ * Dot product in chunks added pairwise
+ */
+static double muged_chunked_dot(MUGED_Arena& arena, const double* first, const double* second, size_t length)
+{
+	MUGED_ArenaScope scope(arena);
 
-	muged_scalar mean_square = muged_mean(local_signal);
+	double* partials = arena.muged_allocate<double>(muged_reduction_chunks(length));
+	muged_dot_kernel dot = muged_dot();
 
-	delete [] local_signal.array;
-	return mean_square.muged_sqrt();
+	return muged_pairwise_reduce(length, partials,
+		[first, second, dot](size_t begin, size_t count, double& partial)
+		{
+			partial = dot(first + begin, second + begin, count);
+		},
+		[](double& partial, const double& other)
+		{
+			partial += other;
+		});
 }
 
-muged_scalar MUGED_DSP::muged_mean_square(muged_array& signal)
+/**
+ * Sums over complex samples
+ */
+static muged_moments muged_array_moments(const muged_scalar* samples, size_t length)
 {
-	size_t size = signal.length;
-	muged_scalar* array = signal.array;
-	muged_scalar square_sum, mean_square;
+	MUGED_ArenaScope scope(MUGED_DSP::muged_scratch());
 
-	for (size_t i = 0; i < size; i++)
-	{
-		muged_scalar& current_scalar = array[i];
-		square_sum += current_scalar.muged_pow();
-	}
-	mean_square = square_sum/size;
+	//Chunks of long signal are summed by threads, results don't depend on their number
+	muged_moments* partials = MUGED_DSP::muged_scratch().muged_allocate<muged_moments>(muged_reduction_chunks(length));
+	muged_moments_kernel kernel = muged_moments_sum();
+
+	return muged_pairwise_reduce(length, partials,
+		[samples, kernel](size_t begin, size_t count, muged_moments& partial)
+		{
+			kernel(samples + begin, count, partial);
+		},
+		muged_combine_moments);
+}
+
+muged_statistics MUGED_DSP::muged_signal_statistics(muged_array& signal)
+{
+	return muged_statistics_from(muged_array_moments(signal.array, signal.length), signal.length);
+}
+
+muged_scalar MUGED_DSP::muged_mean(muged_array& signal)
+{
+	return muged_signal_statistics(signal).mean;
+}
 
-	return mean_square;
+muged_scalar MUGED_DSP::muged_root_mean_square(muged_array& signal)
+{
+	return muged_signal_statistics(signal).root_mean_square;
+}
+
+muged_scalar MUGED_DSP::muged_mean_square(muged_array& signal)
+{
+	return muged_signal_statistics(signal).mean_square;
 }
 
 muged_scalar MUGED_DSP::muged_standard_deviation(muged_array& signal)
 {
-	muged_scalar mean_square = muged_mean_square(signal);
-	muged_scalar mean = muged_mean(signal);
+	return muged_signal_statistics(signal).standard_deviation;
+}
 
-	return ( mean_square - mean.muged_pow() ).muged_sqrt();
+MUGED_Array MUGED_DSP::muged_moving_mean(muged_array& signal, size_t window)
+{
+	MUGED_MovingStatistics moving(window);
+	MUGED_Array result(signal.length, MUGED_UNINITIALIZED);
+	moving.muged_mean_into(signal, result.muged_view());
+
+	return result;
+}
+
+MUGED_Array MUGED_DSP::muged_moving_mean_square(muged_array& signal, size_t window)
+{
+	MUGED_MovingStatistics moving(window);
+	MUGED_Array result(signal.length, MUGED_UNINITIALIZED);
+	moving.muged_mean_square_into(signal, result.muged_view());
+
+	return result;
+}
+
+MUGED_Array MUGED_DSP::muged_moving_root_mean_square(muged_array& signal, size_t window)
+{
+	MUGED_MovingStatistics moving(window);
+	MUGED_Array result(signal.length, MUGED_UNINITIALIZED);
+	moving.muged_root_mean_square_into(signal, result.muged_view());
+
+	return result;
+}
+
+MUGED_Array MUGED_DSP::muged_moving_standard_deviation(muged_array& signal, size_t window)
+{
+	MUGED_MovingStatistics moving(window);
+	MUGED_Array result(signal.length, MUGED_UNINITIALIZED);
+	moving.muged_standard_deviation_into(signal, result.muged_view());
+
+	return result;
 }
 
 void MUGED_DSP::muged_1D_correlation(muged_array& fsignal, muged_array& ssignal,
 																		 size_t min_lag, size_t max_lag,
 																		 muged_array& correlation)
+{
+	correlation.length = 2 * max_lag + 1;
+	correlation.array = new muged_scalar[ correlation.length ];
+
+	muged_execute_correlation(fsignal, ssignal, min_lag, max_lag, correlation);
+}
+
+MUGED_Array MUGED_DSP::muged_1D_correlation(muged_array& fsignal, muged_array& ssignal,
+                                            size_t min_lag, size_t max_lag)
+{
+	MUGED_Array correlation(2 * max_lag + 1, MUGED_UNINITIALIZED);
+	muged_execute_correlation(fsignal, ssignal, min_lag, max_lag, correlation.muged_view());
+
+	return correlation;
+}
+
+size_t MUGED_DSP::muged_1D_correlation_into(muged_array& fsignal, muged_array& ssignal,
+                                            size_t min_lag, size_t max_lag,
+                                            muged_array& correlation)
+{
+	muged_check_capacity(correlation.length, 2 * max_lag + 1);
+
+	muged_array result;
+	result.array = correlation.array;
+	result.length = 2 * max_lag + 1;
+	muged_execute_correlation(fsignal, ssignal, min_lag, max_lag, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_execute_correlation(muged_array& fsignal, muged_array& ssignal,
+                                          size_t min_lag, size_t max_lag,
+                                          muged_array& correlation)
 {
 	muged_scalar* ref_signal = fsignal.array;
 	size_t ref_size = fsignal.length;
@@ -79,9 +216,6 @@ void MUGED_DSP::muged_1D_correlation(muged_array& fsignal, muged_array& ssignal,
 	muged_scalar* deg_signal = ssignal.array;
 	size_t deg_size = ssignal.length;
 
-	correlation.length = 2 * max_lag + 1;
-	correlation.array = new muged_scalar[ correlation.length ];
-
 	for (size_t i = 0; i < correlation.length; i++)
 		correlation.array[i] = muged_scalar(INIT,INIT);
 
@@ -112,220 +246,1116 @@ void MUGED_DSP::muged_1D_correlation(muged_array& fsignal, muged_array& ssignal,
 	}
 }
 
-void MUGED_DSP::muged_2D_correlation(muged_matrix& fsignal, muged_matrix& ssignal, muged_matrix& correlation)
+void MUGED_DSP::muged_2D_correlation(muged_matrix& /*fsignal*/, muged_matrix& /*ssignal*/, muged_matrix& /*correlation*/)
 {
 	throw new MUGED_DSPException(ERR_NOT_IMPLEMENTED);
 }
 
 void MUGED_DSP::muged_1D_fft(muged_array& signal, muged_array& spectrum)
 {
-	//Zero padded
-	muged_array radix_2_signal;
-	muged_array W;
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(signal.length, MUGED_FFT_FORWARD, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
 
 	//Initialize FFT
-	muged_initialize_fft(signal, radix_2_signal, spectrum, W);
+	muged_initialize_fft(*plan, spectrum);
 
 	//Calculate spectrum
-	muged_array* result = muged_fft_kernel(radix_2_signal);
+	muged_execute_fft(*plan, signal, spectrum);
+}
+
+void MUGED_DSP::muged_1D_ifft(muged_array& spectrum, muged_array& signal)
+{
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(spectrum.length, MUGED_FFT_INVERSE, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
 
-	//Store result
-	for (unsigned int i = 0; i < spectrum.length; i++)
-		spectrum.array[i] = (*result).array[i];
+	//Initialize IFFT
+	muged_initialize_fft(*plan, signal);
 
-	//Clean memory
-	delete [] radix_2_signal.array;
-	delete [] result->array;
-	delete result;
+	//Calculate IFFT
+	muged_execute_fft(*plan, spectrum, signal);
 }
 
-void MUGED_DSP::muged_1D_ifft(muged_array& spectrum, muged_array& signal)
+MUGED_Array MUGED_DSP::muged_1D_fft(muged_array& signal)
+{
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(signal.length, MUGED_FFT_FORWARD, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	MUGED_Array spectrum(plan->muged_length(), MUGED_UNINITIALIZED);
+	muged_execute_fft(*plan, signal, spectrum.muged_view());
+
+	return spectrum;
+}
+
+MUGED_Array MUGED_DSP::muged_1D_ifft(muged_array& spectrum)
+{
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(spectrum.length, MUGED_FFT_INVERSE, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	MUGED_Array signal(plan->muged_length(), MUGED_UNINITIALIZED);
+	muged_execute_fft(*plan, spectrum, signal.muged_view());
+
+	return signal;
+}
+
+size_t MUGED_DSP::muged_1D_fft_into(muged_array& signal, muged_array& spectrum)
+{
+	muged_check_capacity(spectrum.length, signal.length);
+
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(signal.length, MUGED_FFT_FORWARD, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	muged_array result;
+	result.array = spectrum.array;
+	result.length = signal.length;
+	muged_execute_fft(*plan, signal, result);
+
+	return result.length;
+}
+
+size_t MUGED_DSP::muged_1D_ifft_into(muged_array& spectrum, muged_array& signal)
+{
+	muged_check_capacity(signal.length, spectrum.length);
+
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(spectrum.length, MUGED_FFT_INVERSE, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	muged_array result;
+	result.array = signal.array;
+	result.length = spectrum.length;
+	muged_execute_fft(*plan, spectrum, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_1D_fft_in_place(muged_array& signal)
+{
+	muged_1D_fft_into(signal, signal);
+}
+
+void MUGED_DSP::muged_1D_ifft_in_place(muged_array& spectrum)
+{
+	muged_1D_ifft_into(spectrum, spectrum);
+}
+
+void MUGED_DSP::muged_1D_rfft(muged_real_array& signal, muged_array& spectrum)
+{
+	spectrum.length = signal.length/2 + 1;
+	spectrum.array = new muged_scalar[spectrum.length];
+
+	muged_execute_rfft(signal, spectrum);
+}
+
+MUGED_Array MUGED_DSP::muged_1D_rfft(muged_real_array& signal)
+{
+	MUGED_Array spectrum(signal.length/2 + 1, MUGED_UNINITIALIZED);
+	muged_execute_rfft(signal, spectrum.muged_view());
+
+	return spectrum;
+}
+
+size_t MUGED_DSP::muged_1D_rfft_into(muged_real_array& signal, muged_array& spectrum)
+{
+	muged_check_capacity(spectrum.length, signal.length/2 + 1);
+
+	muged_array result;
+	result.array = spectrum.array;
+	result.length = signal.length/2 + 1;
+	muged_execute_rfft(signal, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_execute_rfft(muged_real_array& signal, muged_array& spectrum)
+{
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(signal.length, MUGED_FFT_FORWARD, owned, MUGED_FFT_REAL);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(plan->muged_scratch_length());
+	plan->muged_execute_real(signal.array, signal.length, spectrum.array, scratch);
+}
+
+void MUGED_DSP::muged_1D_irfft(muged_array& spectrum, size_t length, muged_real_array& signal)
+{
+	//Checked before allocation, so nothing leaks
+	if (spectrum.length < length/2 + 1)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	signal.length = length;
+	signal.array = new double[signal.length];
+
+	muged_execute_irfft(spectrum, signal);
+}
+
+MUGED_RealArray MUGED_DSP::muged_1D_irfft(muged_array& spectrum, size_t length)
+{
+	MUGED_RealArray signal(length, MUGED_UNINITIALIZED);
+	muged_execute_irfft(spectrum, signal.muged_view());
+
+	return signal;
+}
+
+size_t MUGED_DSP::muged_1D_irfft_into(muged_array& spectrum, size_t length, muged_real_array& signal)
+{
+	muged_check_capacity(signal.length, length);
+
+	muged_real_array result;
+	result.array = signal.array;
+	result.length = length;
+	muged_execute_irfft(spectrum, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_execute_irfft(muged_array& spectrum, muged_real_array& signal)
+{
+	if (spectrum.length < signal.length/2 + 1)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(signal.length, MUGED_FFT_INVERSE, owned, MUGED_FFT_REAL);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(plan->muged_scratch_length());
+	plan->muged_execute_real(spectrum.array, signal.array, scratch);
+
+	//Normalize
+	for (size_t i = 0; i < signal.length; i++)
+		signal.array[i] /= signal.length;
+}
+
+void MUGED_DSP::muged_1D_fft_batch(muged_array& signals, size_t length, size_t count,
+                                   size_t stride, size_t distance, muged_array& spectra)
+{
+	muged_check_batch(signals, length, count, stride, distance);
+
+	spectra.length = count * length;
+	spectra.array = new muged_scalar[spectra.length];
+
+	muged_batch_fft(signals, length, count, stride, distance, MUGED_FFT_FORWARD, spectra);
+}
+
+void MUGED_DSP::muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count,
+                                    size_t stride, size_t distance, muged_array& signals)
+{
+	muged_check_batch(spectra, length, count, stride, distance);
+
+	signals.length = count * length;
+	signals.array = new muged_scalar[signals.length];
+
+	muged_batch_fft(spectra, length, count, stride, distance, MUGED_FFT_INVERSE, signals);
+}
+
+MUGED_Array MUGED_DSP::muged_1D_fft_batch(muged_array& signals, size_t length, size_t count,
+                                          size_t stride, size_t distance)
+{
+	muged_check_batch(signals, length, count, stride, distance);
+
+	MUGED_Array spectra(count * length, MUGED_UNINITIALIZED);
+	muged_batch_fft(signals, length, count, stride, distance, MUGED_FFT_FORWARD, spectra.muged_view());
+
+	return spectra;
+}
+
+MUGED_Array MUGED_DSP::muged_1D_ifft_batch(muged_array& spectra, size_t length, size_t count,
+                                           size_t stride, size_t distance)
+{
+	muged_check_batch(spectra, length, count, stride, distance);
+
+	MUGED_Array signals(count * length, MUGED_UNINITIALIZED);
+	muged_batch_fft(spectra, length, count, stride, distance, MUGED_FFT_INVERSE, signals.muged_view());
+
+	return signals;
+}
+
+size_t MUGED_DSP::muged_1D_fft_batch_into(muged_array& signals, size_t length, size_t count,
+                                          size_t stride, size_t distance, muged_array& spectra)
+{
+	muged_check_batch(signals, length, count, stride, distance);
+	muged_check_capacity(spectra.length, count * length);
+
+	muged_array result;
+	result.array = spectra.array;
+	result.length = count * length;
+	muged_batch_fft(signals, length, count, stride, distance, MUGED_FFT_FORWARD, result);
+
+	return result.length;
+}
+
+size_t MUGED_DSP::muged_1D_ifft_batch_into(muged_array& spectra, size_t length, size_t count,
+                                           size_t stride, size_t distance, muged_array& signals)
+{
+	muged_check_batch(spectra, length, count, stride, distance);
+	muged_check_capacity(signals.length, count * length);
+
+	muged_array result;
+	result.array = signals.array;
+	result.length = count * length;
+	muged_batch_fft(spectra, length, count, stride, distance, MUGED_FFT_INVERSE, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_1D_fft(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan)
+{
+	if (plan.muged_direction() != MUGED_FFT_FORWARD)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
+
+	//Initialize FFT
+	muged_initialize_fft(plan, spectrum);
+
+	//Calculate spectrum
+	muged_execute_plan(plan, signal, spectrum);
+}
+
+MUGED_Array MUGED_DSP::muged_1D_fft(muged_array& signal, MUGED_FFTPlan& plan)
 {
-	muged_array radix_2_signal;
-	muged_array W;
+	if (plan.muged_direction() != MUGED_FFT_FORWARD)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
+
+	MUGED_Array spectrum(plan.muged_length(), MUGED_UNINITIALIZED);
+	muged_execute_plan(plan, signal, spectrum.muged_view());
+
+	return spectrum;
+}
+
+void MUGED_DSP::muged_1D_ifft(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan)
+{
+	if (plan.muged_direction() != MUGED_FFT_INVERSE)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
 
 	//Initialize IFFT
-	muged_initialize_fft(spectrum, radix_2_signal, signal, W);
+	muged_initialize_fft(plan, signal);
 
 	//Calculate IFFT
-	muged_array* result = muged_ifft_kernel(radix_2_signal);
+	muged_execute_plan(plan, spectrum, signal);
+}
+
+MUGED_Array MUGED_DSP::muged_1D_ifft(muged_array& spectrum, MUGED_FFTPlan& plan)
+{
+	if (plan.muged_direction() != MUGED_FFT_INVERSE)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
+
+	MUGED_Array signal(plan.muged_length(), MUGED_UNINITIALIZED);
+	muged_execute_plan(plan, spectrum, signal.muged_view());
+
+	return signal;
+}
+
+size_t MUGED_DSP::muged_1D_fft_into(muged_array& signal, muged_array& spectrum, MUGED_FFTPlan& plan)
+{
+	if (plan.muged_direction() != MUGED_FFT_FORWARD)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
+
+	muged_check_capacity(spectrum.length, plan.muged_length());
+
+	muged_array result;
+	result.array = spectrum.array;
+	result.length = plan.muged_length();
+	muged_execute_plan(plan, signal, result);
+
+	return result.length;
+}
+
+size_t MUGED_DSP::muged_1D_ifft_into(muged_array& spectrum, muged_array& signal, MUGED_FFTPlan& plan)
+{
+	if (plan.muged_direction() != MUGED_FFT_INVERSE)
+		throw new MUGED_DSPException(ERR_FFT_DIRECTION);
+
+	muged_check_capacity(signal.length, plan.muged_length());
 
-	//Store result
-	for (unsigned int i = 0; i < signal.length; i++)
-		signal.array[i] = (*result).array[i]/radix_2_signal.length;
+	muged_array result;
+	result.array = signal.array;
+	result.length = plan.muged_length();
+	muged_execute_plan(plan, spectrum, result);
+
+	return result.length;
+}
+
+void MUGED_DSP::muged_1D_fft_in_place(muged_array& signal, MUGED_FFTPlan& plan)
+{
+	if (signal.length != plan.muged_length())
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	muged_1D_fft_into(signal, signal, plan);
+}
+
+void MUGED_DSP::muged_1D_ifft_in_place(muged_array& spectrum, MUGED_FFTPlan& plan)
+{
+	if (spectrum.length != plan.muged_length())
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	muged_1D_ifft_into(spectrum, spectrum, plan);
+}
+
+void MUGED_DSP::muged_check_capacity(size_t capacity, size_t length)
+{
+	if (capacity < length)
+		throw new MUGED_DSPException(ERR_ARRAY_LENGTH);
+}
+
+void MUGED_DSP::muged_execute_plan(MUGED_FFTPlan& plan, muged_array& input, muged_array& output)
+{
+	plan.muged_execute(input.array, input.length, output.array);
+
+	//Normalize
+	if (plan.muged_direction() == MUGED_FFT_INVERSE)
+	{
+		for (unsigned int i = 0; i < output.length; i++)
+			output.array[i] /= output.length;
+	}
+}
+
+void MUGED_DSP::muged_check_batch(muged_array& input, size_t length, size_t count, size_t stride, size_t distance)
+{
+	//Empty signal would wrap the offset of the last sample
+	if (length == 0)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	if (count > 0 && (count - 1) * distance + (length - 1) * stride >= input.length)
+		throw new MUGED_DSPException(ERR_ARRAY_LENGTH);
+}
+
+void MUGED_DSP::muged_batch_fft(muged_array& input, size_t length, size_t count, size_t stride, size_t distance,
+                                MUGED_FFTDirection direction, muged_array& output)
+{
+	if (count == 0)
+		return;
+
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(length, direction, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(plan->muged_scratch_length());
+	plan->muged_execute_batch(input.array, stride, distance, count, output.array, scratch);
+
+	//Normalize
+	if (direction == MUGED_FFT_INVERSE)
+	{
+		for (size_t i = 0; i < output.length; i++)
+			output.array[i] /= length;
+	}
+}
 
-	//Clean memory
-	delete [] radix_2_signal.array;
-	delete [] result->array;
-	delete result;
+MUGED_FFTPlanCache& MUGED_DSP::muged_plan_cache()
+{
+	static MUGED_FFTPlanCache cache;
+	return cache;
+}
 
+MUGED_Arena& MUGED_DSP::muged_scratch()
+{
+	//Temporary buffers of all methods, empty between calls
+	static thread_local MUGED_Arena arena;
+	return arena;
 }
 
-void MUGED_DSP::muged_initialize_fft(muged_array& signal, muged_array& radix_2_signal, muged_array& spectrum, muged_array& W)
+void MUGED_DSP::muged_execute_fft(const MUGED_FFTPlan& plan, muged_array& input, muged_array& output)
 {
-	//Current signal length
-	size_t N = signal.length;
+	MUGED_ArenaScope scope(muged_scratch());
 
-	//Get next 2 power
-	double next_2_pow = pow(2.0, (int)(log2(N) + 0.5));
+	muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(plan.muged_scratch_length());
+	plan.muged_execute(input.array, input.length, output.array, scratch);
 
-	//Spectrum
-	spectrum.length = next_2_pow;
+	//Normalize
+	if (plan.muged_direction() == MUGED_FFT_INVERSE)
+	{
+		for (unsigned int i = 0; i < output.length; i++)
+			output.array[i] /= output.length;
+	}
+}
+
+void MUGED_DSP::muged_initialize_fft(const MUGED_FFTPlan& plan, muged_array& spectrum)
+{
+	spectrum.length = plan.muged_length();
 	spectrum.array = new muged_scalar[spectrum.length];
+}
+
+void MUGED_DSP::muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
+{
+	muged_initialize_2D(signal.rows, signal.cols, spectrum);
+	muged_2D_transform(signal.matrix, MUGED_FFT_FORWARD, MUGED_MatrixView(spectrum));
+}
+
+void MUGED_DSP::muged_2D_ifft(muged_matrix& spectrum, muged_matrix& signal)
+{
+	muged_initialize_2D(spectrum.rows, spectrum.cols, signal);
+	muged_2D_transform(spectrum.matrix, MUGED_FFT_INVERSE, MUGED_MatrixView(signal));
+}
+
+MUGED_Matrix MUGED_DSP::muged_2D_fft(muged_matrix& signal)
+{
+	MUGED_Matrix spectrum(signal.rows, signal.cols, MUGED_UNINITIALIZED);
+	muged_2D_transform(signal.matrix, MUGED_FFT_FORWARD, spectrum.muged_strided_view());
+
+	return spectrum;
+}
+
+MUGED_Matrix MUGED_DSP::muged_2D_ifft(muged_matrix& spectrum)
+{
+	MUGED_Matrix signal(spectrum.rows, spectrum.cols, MUGED_UNINITIALIZED);
+	muged_2D_transform(spectrum.matrix, MUGED_FFT_INVERSE, signal.muged_strided_view());
+
+	return signal;
+}
+
+MUGED_Matrix MUGED_DSP::muged_2D_fft(const MUGED_MatrixView& signal)
+{
+	MUGED_Matrix spectrum(signal.muged_rows(), signal.muged_cols(), MUGED_UNINITIALIZED);
+
+	std::vector<muged_scalar*> rows(signal.muged_rows());
+	for (size_t r = 0; r < rows.size(); r++)
+		rows[r] = signal[r];
+
+	muged_2D_transform(rows.data(), MUGED_FFT_FORWARD, spectrum.muged_strided_view());
+
+	return spectrum;
+}
+
+MUGED_Matrix MUGED_DSP::muged_2D_ifft(const MUGED_MatrixView& spectrum)
+{
+	MUGED_Matrix signal(spectrum.muged_rows(), spectrum.muged_cols(), MUGED_UNINITIALIZED);
+
+	std::vector<muged_scalar*> rows(spectrum.muged_rows());
+	for (size_t r = 0; r < rows.size(); r++)
+		rows[r] = spectrum[r];
+
+	muged_2D_transform(rows.data(), MUGED_FFT_INVERSE, signal.muged_strided_view());
+
+	return signal;
+}
+
+void MUGED_DSP::muged_2D_fft_into(muged_matrix& signal, MUGED_MatrixView spectrum)
+{
+	if (signal.rows != spectrum.muged_rows() || signal.cols != spectrum.muged_cols())
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	muged_2D_transform(signal.matrix, MUGED_FFT_FORWARD, spectrum);
+}
+
+void MUGED_DSP::muged_2D_ifft_into(muged_matrix& spectrum, MUGED_MatrixView signal)
+{
+	if (spectrum.rows != signal.muged_rows() || spectrum.cols != signal.muged_cols())
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	muged_2D_transform(spectrum.matrix, MUGED_FFT_INVERSE, signal);
+}
+
+void MUGED_DSP::muged_2D_fft_into(const MUGED_MatrixView& signal, MUGED_MatrixView spectrum)
+{
+	if (signal.muged_rows() != spectrum.muged_rows() || signal.muged_cols() != spectrum.muged_cols())
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	std::vector<muged_scalar*> rows(signal.muged_rows());
+	for (size_t r = 0; r < rows.size(); r++)
+		rows[r] = signal[r];
+
+	muged_2D_transform(rows.data(), MUGED_FFT_FORWARD, spectrum);
+}
+
+void MUGED_DSP::muged_2D_ifft_into(const MUGED_MatrixView& spectrum, MUGED_MatrixView signal)
+{
+	if (spectrum.muged_rows() != signal.muged_rows() || spectrum.muged_cols() != signal.muged_cols())
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	std::vector<muged_scalar*> rows(spectrum.muged_rows());
+	for (size_t r = 0; r < rows.size(); r++)
+		rows[r] = spectrum[r];
+
+	muged_2D_transform(rows.data(), MUGED_FFT_INVERSE, signal);
+}
+
+void MUGED_DSP::muged_2D_fft_in_place(MUGED_MatrixView signal)
+{
+	muged_2D_transform(NULL, MUGED_FFT_FORWARD, signal);
+}
+
+void MUGED_DSP::muged_2D_ifft_in_place(MUGED_MatrixView spectrum)
+{
+	muged_2D_transform(NULL, MUGED_FFT_INVERSE, spectrum);
+}
+
+void MUGED_DSP::muged_initialize_2D(size_t rows, size_t cols, muged_matrix& output)
+{
+	if (rows == 0 || cols == 0)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	//Result rows share one block
+	output.rows = rows;
+	output.cols = cols;
+	output.matrix = new muged_scalar*[rows];
+	output.matrix[0] = new muged_scalar[rows * cols];
+	for (size_t r = 1; r < rows; r++)
+		output.matrix[r] = output.matrix[0] + r * cols;
+}
+
+void MUGED_DSP::muged_2D_transform(muged_scalar* const* input, MUGED_FFTDirection direction, MUGED_MatrixView output)
+{
+	size_t rows = output.muged_rows();
+	size_t cols = output.muged_cols();
+
+	if (rows == 0 || cols == 0)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	bool row_owned, column_owned;
+	const MUGED_FFTPlan* row_plan = muged_plan_cache().muged_plan(cols, direction, row_owned);
+	const MUGED_FFTPlan* column_plan = muged_plan_cache().muged_plan(rows, direction, column_owned);
+	std::unique_ptr<const MUGED_FFTPlan> row_guard(row_owned ? row_plan : NULL);
+	std::unique_ptr<const MUGED_FFTPlan> column_guard(column_owned ? column_plan : NULL);
+
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_scalar* transposed = muged_scratch().muged_allocate<muged_scalar>(rows * cols);
+
+	//Small matrices are not worth waking other threads
+	size_t parts = rows * cols >= MUGED_PARALLEL_LENGTH ? muged_thread_count() : 1;
+	size_t row_parts = parts < rows ? parts : rows;
+	size_t column_parts = parts < cols ? parts : cols;
+
+	//Every part of work has its own scratch, workers don't touch arena
+	size_t scratch_length = row_plan->muged_scratch_length() > column_plan->muged_scratch_length() ?
+	                        row_plan->muged_scratch_length() : column_plan->muged_scratch_length();
+	muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(parts * scratch_length);
+
+	//Transforms of rows
+	muged_parallel_body row_body = [&](size_t begin, size_t end)
+	{
+		for (size_t part = begin; part < end; part++)
+		{
+			muged_scalar* part_scratch = scratch + part * scratch_length;
+
+			for (size_t r = part * rows / row_parts; r < (part + 1) * rows / row_parts; r++)
+				row_plan->muged_execute(input != NULL ? input[r] : output[r], cols, output[r], part_scratch);
+		}
+	};
+
+	//Transforms of columns (rows of transposed matrix), normalized in cache
+	muged_parallel_body column_body = [&](size_t begin, size_t end)
+	{
+		for (size_t part = begin; part < end; part++)
+		{
+			muged_scalar* part_scratch = scratch + part * scratch_length;
+
+			for (size_t c = part * cols / column_parts; c < (part + 1) * cols / column_parts; c++)
+			{
+				muged_scalar* column = transposed + c * rows;
+				column_plan->muged_execute(column, rows, column, part_scratch);
+
+				if (direction == MUGED_FFT_INVERSE)
+				{
+					for (size_t r = 0; r < rows; r++)
+						column[r] /= rows * cols;
+				}
+			}
+		}
+	};
 
-	//Zero padded
-	radix_2_signal.length = spectrum.length;
-	radix_2_signal.array = new muged_scalar[radix_2_signal.length];
+	muged_parallel_for(row_parts, row_body);
 
-	//Padding zeros
-	for (unsigned int i = 0; i < radix_2_signal.length; i++)
+	muged_transpose(output.muged_data(), rows, cols, output.muged_stride(), transposed, rows);
+
+	muged_parallel_for(column_parts, column_body);
+
+	muged_transpose(transposed, cols, rows, rows, output.muged_data(), output.muged_stride());
+}
+
+void MUGED_DSP::muged_to_split(muged_array& signal, muged_split_array& split)
+{
+	muged_split_allocate(split, signal.length);
+	muged_deinterleave()(signal.array, signal.length, split.real, split.imag);
+}
+
+void MUGED_DSP::muged_from_split(muged_split_array& split, muged_array& signal)
+{
+	signal.length = split.length;
+	signal.array = new muged_scalar[signal.length];
+	muged_interleave()(split.real, split.imag, split.length, signal.array);
+}
+
+size_t MUGED_DSP::muged_to_split_into(muged_array& signal, muged_split_array& split)
+{
+	muged_check_capacity(split.length, signal.length);
+	if (split.imag == NULL)
+		throw new MUGED_DSPException(ERR_SPLIT_IMAG);
+
+	muged_deinterleave()(signal.array, signal.length, split.real, split.imag);
+	return signal.length;
+}
+
+size_t MUGED_DSP::muged_from_split_into(muged_split_array& split, muged_array& signal)
+{
+	muged_check_capacity(signal.length, split.length);
+
+	muged_interleave()(split.real, split.imag, split.length, signal.array);
+	return split.length;
+}
+
+void MUGED_DSP::muged_1D_fft(muged_split_array& signal, muged_split_array& spectrum)
+{
+	muged_split_array result;
+	muged_split_allocate(result, signal.length);
+
+	try
+	{
+		muged_split_transform(signal, MUGED_FFT_FORWARD, result);
+	}
+	catch (...)
+	{
+		muged_split_free(result);
+		throw;
+	}
+
+	spectrum = result;
+}
+
+void MUGED_DSP::muged_1D_ifft(muged_split_array& spectrum, muged_split_array& signal)
+{
+	muged_split_array result;
+	muged_split_allocate(result, spectrum.length);
+
+	try
+	{
+		muged_split_transform(spectrum, MUGED_FFT_INVERSE, result);
+	}
+	catch (...)
 	{
-		if ( i < signal.length)
-			radix_2_signal.array[i] = signal.array[i];
-		else
-			radix_2_signal.array[i] = muged_scalar();
+		muged_split_free(result);
+		throw;
 	}
 
-	///TODO calculate twiddle factors
+	signal = result;
+}
+
+size_t MUGED_DSP::muged_1D_fft_into(muged_split_array& signal, muged_split_array& spectrum)
+{
+	muged_check_capacity(spectrum.length, signal.length);
+	if (spectrum.imag == NULL)
+		throw new MUGED_DSPException(ERR_SPLIT_IMAG);
+
+	muged_split_transform(signal, MUGED_FFT_FORWARD, spectrum);
+	return signal.length;
 }
 
-muged_array* MUGED_DSP::muged_fft_kernel(muged_array& radix_2_signal)
+size_t MUGED_DSP::muged_1D_ifft_into(muged_split_array& spectrum, muged_split_array& signal)
 {
-	size_t N = radix_2_signal.length;
+	muged_check_capacity(signal.length, spectrum.length);
+	if (signal.imag == NULL)
+		throw new MUGED_DSPException(ERR_SPLIT_IMAG);
+
+	muged_split_transform(spectrum, MUGED_FFT_INVERSE, signal);
+	return spectrum.length;
+}
 
-	//Create output array
-	muged_array* spectrum = new muged_array;
+void MUGED_DSP::muged_split_transform(muged_split_array& input, MUGED_FFTDirection direction, muged_split_array& output)
+{
+	size_t length = input.length;
+	bool real = input.imag == NULL && direction == MUGED_FFT_FORWARD;
+
+	bool owned;
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(length, direction, owned,
+	                                                          real ? MUGED_FFT_REAL : MUGED_FFT_COMPLEX);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
+
+	//Plans work on interleaved samples, conversion is one pass on each side
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_scalar* buffer = muged_scratch().muged_allocate<muged_scalar>(length + plan->muged_scratch_length());
+	muged_scalar* scratch = buffer + length;
+
+	if (real)
+	{
+		//Half spectrum, the rest is conjugate symmetric
+		plan->muged_execute_real(input.real, length, buffer, scratch);
+
+		for (size_t k = length/2 + 1; k < length; k++)
+			buffer[k] = buffer[length - k].muged_conj();
+	}
+	else
+	{
+		muged_interleave()(input.real, input.imag, length, buffer);
+		plan->muged_execute(buffer, length, buffer, scratch);
+	}
 
-	(*spectrum).length = N;
-	(*spectrum).array = new muged_scalar[(*spectrum).length];
+	muged_deinterleave()(buffer, length, output.real, output.imag);
 
-	//Stop condition
-	if (N == 1)
+	//Normalize
+	if (direction == MUGED_FFT_INVERSE)
 	{
-		for (unsigned int i = 0; i < (*spectrum).length; i++)
-			(*spectrum).array[i] = radix_2_signal.array[i];
+		for (size_t i = 0; i < length; i++)
+		{
+			output.real[i] /= length;
+			output.imag[i] /= length;
+		}
+	}
+}
+
+muged_scalar MUGED_DSP::muged_mean(muged_split_array& signal)
+{
+	double real = muged_chunked_sum(muged_scratch(), signal.real, signal.length);
+	double imag = signal.imag != NULL ? muged_chunked_sum(muged_scratch(), signal.imag, signal.length) : 0;
 
-		//Output
-		return spectrum;
+	return muged_scalar(real, imag) / signal.length;
+}
+
+muged_scalar MUGED_DSP::muged_mean_square(muged_split_array& signal)
+{
+	//z^2 = (a^2 - b^2) + 2abi
+	double real = muged_chunked_dot(muged_scratch(), signal.real, signal.real, signal.length);
+	double imag = 0;
+
+	if (signal.imag != NULL)
+	{
+		real -= muged_chunked_dot(muged_scratch(), signal.imag, signal.imag, signal.length);
+		imag = 2 * muged_chunked_dot(muged_scratch(), signal.real, signal.imag, signal.length);
 	}
 
-	double pi = 4 * atan(1);
+	return muged_scalar(real, imag) / signal.length;
+}
+
+muged_scalar MUGED_DSP::muged_root_mean_square(muged_split_array& signal)
+{
+	//|z^2| = a^2 + b^2
+	double sum = muged_chunked_dot(muged_scratch(), signal.real, signal.real, signal.length);
+	if (signal.imag != NULL)
+		sum += muged_chunked_dot(muged_scratch(), signal.imag, signal.imag, signal.length);
+
+	return muged_scalar(sum / signal.length, 0).muged_sqrt();
+}
+
+muged_scalar MUGED_DSP::muged_standard_deviation(muged_split_array& signal)
+{
+	muged_scalar mean_square = muged_mean_square(signal);
+	muged_scalar mean = muged_mean(signal);
+
+	return ( mean_square - mean.muged_pow() ).muged_sqrt();
+}
+
+void MUGED_DSP::muged_1D_correlation(muged_split_array& fsignal, muged_split_array& ssignal,
+                                     size_t min_lag, size_t max_lag,
+                                     muged_split_array& correlation)
+{
+	bool complex = fsignal.imag != NULL || ssignal.imag != NULL;
+
+	muged_split_allocate(correlation, 2 * max_lag + 1, complex);
+	muged_execute_split_correlation(fsignal, ssignal, min_lag, max_lag, correlation);
+}
+
+size_t MUGED_DSP::muged_1D_correlation_into(muged_split_array& fsignal, muged_split_array& ssignal,
+                                            size_t min_lag, size_t max_lag,
+                                            muged_split_array& correlation)
+{
+	muged_check_capacity(correlation.length, 2 * max_lag + 1);
+	if ((fsignal.imag != NULL || ssignal.imag != NULL) && correlation.imag == NULL)
+		throw new MUGED_DSPException(ERR_SPLIT_IMAG);
 
-	//Calculate W - wage of twiddle factor
-	muged_scalar W = muged_scalar(1, -2*pi/N, false);
+	muged_split_array result = correlation;
+	result.length = 2 * max_lag + 1;
+	muged_execute_split_correlation(fsignal, ssignal, min_lag, max_lag, result);
 
-	//Even part
-	muged_array even_part;
-	even_part.length = N/2;
-	even_part.array = new muged_scalar[even_part.length];
+	return result.length;
+}
 
-	for (unsigned int sample = 0; sample < N; sample += 2)
-		even_part.array[sample/2] = radix_2_signal.array[sample];
+void MUGED_DSP::muged_execute_split_correlation(muged_split_array& fsignal, muged_split_array& ssignal,
+                                                size_t min_lag, size_t max_lag,
+                                                muged_split_array& correlation)
+{
+	bool complex = correlation.imag != NULL;
+	muged_dot_kernel dot = muged_dot();
 
-	//Odd part
-	muged_array odd_part;
-	odd_part.length = N/2;
-	odd_part.array = new muged_scalar[odd_part.length];
+	for (size_t i = 0; i < correlation.length; i++)
+	{
+		correlation.real[i] = INIT;
+		if (complex)
+			correlation.imag[i] = INIT;
+	}
 
-	for (unsigned int sample = 1; sample < N; sample += 2)
-		odd_part.array[sample/2] = radix_2_signal.array[sample];
+	//range: -max_lag : -min_lag and min_lag+1 : max_lag
+	for (long long lag = -(long long)max_lag; lag <= (long long)max_lag; lag++)
+	{
+		if (lag > -(long long)min_lag && lag <= (long long)min_lag)
+			continue;
+
+		//Samples with both f[sample] and s[sample - lag] inside signals
+		long long begin = lag > 0 ? lag : 0;
+		long long end = (long long)ssignal.length + lag;
+		if (end > (long long)fsignal.length)
+			end = fsignal.length;
+
+		if (end <= begin)
+			continue;
+
+		size_t length = end - begin;
+		const double* f_real = fsignal.real + begin;
+		const double* s_real = ssignal.real + (begin - lag);
+		const double* f_imag = fsignal.imag != NULL ? fsignal.imag + begin : NULL;
+		const double* s_imag = ssignal.imag != NULL ? ssignal.imag + (begin - lag) : NULL;
+
+		//f * conj(s) = (fr*sr + fi*si) + (fi*sr - fr*si)i
+		double real = dot(f_real, s_real, length);
+		double imag = 0;
+
+		if (f_imag != NULL && s_imag != NULL)
+			real += dot(f_imag, s_imag, length);
+		if (f_imag != NULL)
+			imag += dot(f_imag, s_real, length);
+		if (s_imag != NULL)
+			imag -= dot(f_real, s_imag, length);
+
+		correlation.real[lag + max_lag] = real;
+		if (complex)
+			correlation.imag[lag + max_lag] = imag;
+	}
+}
 
-	//Spectrum
-	muged_array* spectrum_even = muged_fft_kernel(even_part);
-	muged_array* spectrum_odd  = muged_fft_kernel(odd_part);
+/**
+ * Sums of one pass over count samples from begin. Reader converts sample i,
+ * so every format gets its own loop.
+ */
+template <class Reader>
+static void muged_view_moments(size_t begin, size_t count, const Reader& reader, muged_moments& moments)
+{
+	muged_moments sums = { 0, 0, 0, 0, 0, HUGE_VAL, 0 };
 
-	for (unsigned int k = 0; k < N/2; k++)
+	for (size_t i = begin; i < begin + count; i++)
 	{
-		(*spectrum).array[k]       = (*spectrum_even).array[k] + W.muged_pow(k)*(*spectrum_odd).array[k];
-		(*spectrum).array[k + N/2] = (*spectrum_even).array[k] - W.muged_pow(k)*(*spectrum_odd).array[k];
+		double re, im;
+		reader(i, re, im);
+
+		double norm = re * re + im * im;
+
+		sums.real += re;
+		sums.imag += im;
+		sums.real_real += re * re;
+		sums.imag_imag += im * im;
+		sums.real_imag += re * im;
+
+		if (norm < sums.min_norm)
+			sums.min_norm = norm;
+		if (norm > sums.max_norm)
+			sums.max_norm = norm;
 	}
 
-	//Clean memory
-	delete [] spectrum_even->array;
-	delete [] spectrum_odd->array;
-	delete [] even_part.array;
-	delete [] odd_part.array;
-	delete spectrum_even;
-	delete spectrum_odd;
+	moments = sums;
+}
 
-	//Output
-	return spectrum;
+/**
+ * Sums over all samples, added pairwise like sums of muged_array, so results
+ * don't depend on number of threads
+ */
+template <class Reader>
+static muged_moments muged_view_moments(size_t length, const Reader& reader)
+{
+	MUGED_ArenaScope scope(MUGED_DSP::muged_scratch());
+
+	muged_moments* partials = MUGED_DSP::muged_scratch().muged_allocate<muged_moments>(muged_reduction_chunks(length));
+
+	return muged_pairwise_reduce(length, partials,
+		[&reader](size_t begin, size_t count, muged_moments& partial)
+		{
+			muged_view_moments(begin, count, reader, partial);
+		},
+		muged_combine_moments);
 }
 
-muged_array* MUGED_DSP::muged_ifft_kernel(muged_array& radix_2_signal)
+static muged_moments muged_view_moments(const MUGED_SampleView& signal)
 {
-	size_t N = radix_2_signal.length;
+	const void* data = signal.muged_data();
+	double scale = signal.muged_scale();
+	muged_moments moments;
 
-	//Create output array
-	muged_array* signal = new muged_array;
+	switch (signal.muged_format())
+	{
+	case MUGED_SAMPLE_COMPLEX:
+		moments = muged_array_moments((const muged_scalar*)data, signal.muged_length());
+		break;
 
-	(*signal).length = N;
-	(*signal).array = new muged_scalar[(*signal).length];
+	case MUGED_SAMPLE_REAL:
+	{
+		const double* samples = (const double*)data;
+		moments = muged_view_moments(signal.muged_length(), [samples](size_t i, double& re, double& im)
+		{
+			re = samples[i];
+			im = 0;
+		});
+		break;
+	}
 
-	//Stop condition
-	if (N == 1)
+	case MUGED_SAMPLE_FLOAT_IQ:
 	{
-		for (unsigned int i = 0; i < (*signal).length; i++)
-			(*signal).array[i] = radix_2_signal.array[i];
+		const float* samples = (const float*)data;
+		moments = muged_view_moments(signal.muged_length(), [samples](size_t i, double& re, double& im)
+		{
+			re = samples[2 * i];
+			im = samples[2 * i + 1];
+		});
+		break;
+	}
 
-		//Output
-		return signal;
+	case MUGED_SAMPLE_INT16_IQ:
+	{
+		//Scale is applied to sums, not to every sample
+		const int16_t* samples = (const int16_t*)data;
+		moments = muged_view_moments(signal.muged_length(), [samples](size_t i, double& re, double& im)
+		{
+			re = samples[2 * i];
+			im = samples[2 * i + 1];
+		});
+
+		moments.real *= scale;
+		moments.imag *= scale;
+		moments.real_real *= scale * scale;
+		moments.imag_imag *= scale * scale;
+		moments.real_imag *= scale * scale;
+		moments.min_norm *= scale * scale;
+		moments.max_norm *= scale * scale;
+		break;
 	}
+	}
+
+	return moments;
+}
+
+muged_statistics MUGED_DSP::muged_signal_statistics(const MUGED_SampleView& signal)
+{
+	return muged_statistics_from(muged_view_moments(signal), signal.muged_length());
+}
+
+muged_scalar MUGED_DSP::muged_mean(const MUGED_SampleView& signal)
+{
+	return muged_signal_statistics(signal).mean;
+}
+
+muged_scalar MUGED_DSP::muged_mean_square(const MUGED_SampleView& signal)
+{
+	return muged_signal_statistics(signal).mean_square;
+}
+
+muged_scalar MUGED_DSP::muged_root_mean_square(const MUGED_SampleView& signal)
+{
+	return muged_signal_statistics(signal).root_mean_square;
+}
+
+muged_scalar MUGED_DSP::muged_standard_deviation(const MUGED_SampleView& signal)
+{
+	return muged_signal_statistics(signal).standard_deviation;
+}
 
-	double pi = 4 * atan(1);
+MUGED_Array MUGED_DSP::muged_1D_fft(const MUGED_SampleView& signal)
+{
+	MUGED_Array spectrum(signal.muged_length(), MUGED_UNINITIALIZED);
+	muged_1D_fft_into(signal, spectrum.muged_view());
+
+	return spectrum;
+}
 
-	//Calculate W - wage of twiddle factor
-	muged_scalar W = muged_scalar(1, -2*pi/N, false).muged_conj();
+size_t MUGED_DSP::muged_1D_fft_into(const MUGED_SampleView& signal, muged_array& spectrum)
+{
+	size_t length = signal.muged_length();
+	muged_check_capacity(spectrum.length, length);
+
+	MUGED_ArenaScope scope(muged_scratch());
+	bool owned;
 
-	//Even part
-	muged_array even_part;
-	even_part.length = N/2;
-	even_part.array = new muged_scalar[even_part.length];
+	if (signal.muged_format() == MUGED_SAMPLE_REAL)
+	{
+		//Real plan reads samples of caller, the rest of spectrum is conjugate symmetric
+		const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(length, MUGED_FFT_FORWARD, owned, MUGED_FFT_REAL);
+		std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
 
-	for (unsigned int sample = 0; sample < N; sample += 2)
-		even_part.array[sample/2] = radix_2_signal.array[sample];
+		muged_scalar* scratch = muged_scratch().muged_allocate<muged_scalar>(plan->muged_scratch_length());
+		plan->muged_execute_real((const double*)signal.muged_data(), length, spectrum.array, scratch);
 
-	//Odd part
-	muged_array odd_part;
-	odd_part.length = N/2;
-	odd_part.array = new muged_scalar[odd_part.length];
+		for (size_t k = length/2 + 1; k < length; k++)
+			spectrum.array[k] = spectrum.array[length - k].muged_conj();
 
-	for (unsigned int sample = 1; sample < N; sample += 2)
-		odd_part.array[sample/2] = radix_2_signal.array[sample];
+		return length;
+	}
 
-	//Spectrum
-	muged_array* signal_even = muged_ifft_kernel(even_part);
-	muged_array* signal_odd  = muged_ifft_kernel(odd_part);
+	const MUGED_FFTPlan* plan = muged_plan_cache().muged_plan(length, MUGED_FFT_FORWARD, owned);
+	std::unique_ptr<const MUGED_FFTPlan> plan_guard(owned ? plan : NULL);
 
-	for (unsigned int k = 0; k < N/2; k++)
+	//Other formats are converted straight into spectrum and transformed in place
+	muged_array input;
+	input.length = length;
+
+	if (signal.muged_format() == MUGED_SAMPLE_COMPLEX)
+	{
+		input.array = (muged_scalar*)signal.muged_data();
+	}
+	else
 	{
-		(*signal).array[k]       = (*signal_even).array[k] + W.muged_pow(k)*(*signal_odd).array[k];
-		(*signal).array[k + N/2] = (*signal_even).array[k] - W.muged_pow(k)*(*signal_odd).array[k];
+		signal.muged_convert(0, length, spectrum.array);
+		input.array = spectrum.array;
 	}
 
-	//Clean memory
-	delete [] signal_even->array;
-	delete [] signal_odd->array;
-	delete [] even_part.array;
-	delete [] odd_part.array;
-	delete signal_even;
-	delete signal_odd;
+	muged_array result;
+	result.array = spectrum.array;
+	result.length = length;
+	muged_execute_fft(*plan, input, result);
 
-	//Output
-	return signal;
+	return length;
 }
 
-void MUGED_DSP::muged_2D_fft(muged_matrix& signal, muged_matrix& spectrum)
+MUGED_Array MUGED_DSP::muged_1D_correlation(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal,
+                                            size_t min_lag, size_t max_lag)
 {
-	throw new MUGED_DSPException(ERR_NOT_IMPLEMENTED);
+	MUGED_Array correlation(2 * max_lag + 1, MUGED_UNINITIALIZED);
+	muged_1D_correlation_into(fsignal, ssignal, min_lag, max_lag, correlation.muged_view());
+
+	return correlation;
 }
 
-void MUGED_DSP::muged_2D_ifft(muged_matrix& spectrum, muged_matrix& signal)
+size_t MUGED_DSP::muged_1D_correlation_into(const MUGED_SampleView& fsignal, const MUGED_SampleView& ssignal,
+                                            size_t min_lag, size_t max_lag,
+                                            muged_array& correlation)
 {
-	throw new MUGED_DSPException(ERR_NOT_IMPLEMENTED);
+	muged_check_capacity(correlation.length, 2 * max_lag + 1);
+
+	//Every sample is read many times, so signals are converted once
+	MUGED_ArenaScope scope(muged_scratch());
+
+	muged_array first = muged_complex_samples(fsignal);
+	muged_array second = muged_complex_samples(ssignal);
+
+	muged_array result;
+	result.array = correlation.array;
+	result.length = 2 * max_lag + 1;
+	muged_execute_correlation(first, second, min_lag, max_lag, result);
+
+	return result.length;
+}
+
+muged_array MUGED_DSP::muged_complex_samples(const MUGED_SampleView& view)
+{
+	muged_array samples;
+	samples.length = view.muged_length();
+
+	if (view.muged_format() == MUGED_SAMPLE_COMPLEX)
+	{
+		samples.array = (muged_scalar*)view.muged_data();
+	}
+	else
+	{
+		samples.array = muged_scratch().muged_allocate<muged_scalar>(samples.length);
+		view.muged_convert(0, samples.length, samples.array);
+	}
+
+	return samples;
 }
 
-void MUGED_DSP::muged_kalman(muged_array& signal, muged_array& filtered_signal)
+void MUGED_DSP::muged_kalman(muged_array& /*signal*/, muged_array& /*filtered_signal*/)
 {
 	throw new MUGED_DSPException(ERR_NOT_IMPLEMENTED);
 }
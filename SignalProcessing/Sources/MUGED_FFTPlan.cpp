@@ -0,0 +1,752 @@
+#include <algorithm>
+
+#include "MUGED_FFTPlan.h"
+#include "MUGED_Parallel.h"
+#include "MUGED_SIMD.h"
+
+/**
+ * Radix-2 butterfly of mixed-radix stage
+ */
+static void muged_butterfly_2(muged_scalar* output, size_t fstride, const muged_scalar* twiddles, size_t m)
+{
+	for (size_t k = 0; k < m; k++)
+	{
+		muged_scalar t = output[k + m] * twiddles[k * fstride];
+		output[k + m] = output[k] - t;
+		output[k] += t;
+	}
+}
+
+/**
+ * Radix-4 butterfly of mixed-radix stage
+ */
+static void muged_butterfly_4(muged_scalar* output, size_t fstride, const muged_scalar* twiddles, size_t m,
+                              MUGED_FFTDirection direction)
+{
+	for (size_t k = 0; k < m; k++)
+	{
+		muged_scalar s0 = output[k + m] * twiddles[k * fstride];
+		muged_scalar s1 = output[k + 2*m] * twiddles[2 * k * fstride];
+		muged_scalar s2 = output[k + 3*m] * twiddles[3 * k * fstride];
+
+		muged_scalar s5 = output[k] - s1;
+		muged_scalar s4 = s0 - s2;
+		muged_scalar s3 = s0 + s2;
+		muged_scalar x0 = output[k] + s1;
+
+		output[k] = x0 + s3;
+		output[k + 2*m] = x0 - s3;
+
+		//Multiply s4 by direction*i
+		muged_scalar rotated = muged_scalar(-direction * s4.muged_imag(), direction * s4.muged_real());
+		output[k + m] = s5 + rotated;
+		output[k + 3*m] = s5 - rotated;
+	}
+}
+
+/**
+ * Odd prime radix butterfly of mixed-radix stage. Uses symmetry of roots of unity:
+ * X_u = y_0 + sum(a_q*cos(2πuq/p)) + i*sum(b_q*sin(2πuq/p)), where
+ * a_q = y_q + y_p-q, b_q = y_q - y_p-q, X_p-u differs by the sign of the second sum.
+ */
+static void muged_butterfly_odd(muged_scalar* output, size_t fstride, const muged_scalar* twiddles, size_t m, size_t p)
+{
+	muged_scalar y[MUGED_FFT_MAX_RADIX];
+	muged_scalar a[MUGED_FFT_MAX_RADIX/2 + 1];
+	muged_scalar b[MUGED_FFT_MAX_RADIX/2 + 1];
+
+	size_t half = (p - 1)/2;
+
+	//Twiddles of p-point DFT
+	size_t root = fstride * m;
+
+	for (size_t k = 0; k < m; k++)
+	{
+		y[0] = output[k];
+		for (size_t q = 1; q < p; q++)
+			y[q] = output[k + q*m] * twiddles[q * k * fstride];
+
+		muged_scalar sum = y[0];
+		for (size_t q = 1; q <= half; q++)
+		{
+			a[q] = y[q] + y[p - q];
+			b[q] = y[q] - y[p - q];
+			sum += a[q];
+		}
+
+		for (size_t u = 1; u <= half; u++)
+		{
+			double a_real = y[0].muged_real();
+			double a_imag = y[0].muged_imag();
+			double b_real = 0;
+			double b_imag = 0;
+
+			for (size_t q = 1; q <= half; q++)
+			{
+				const muged_scalar& w = twiddles[((u * q) % p) * root];
+				a_real += a[q].muged_real() * w.muged_real();
+				a_imag += a[q].muged_imag() * w.muged_real();
+				b_real += b[q].muged_real() * w.muged_imag();
+				b_imag += b[q].muged_imag() * w.muged_imag();
+			}
+
+			output[k + u*m]       = muged_scalar(a_real - b_imag, a_imag + b_real);
+			output[k + (p - u)*m] = muged_scalar(a_real + b_imag, a_imag - b_real);
+		}
+
+		output[k] = sum;
+	}
+}
+
+/**
+ * Number of rows N1 of six-step matrix, the largest factor not greater than sqrt(N).
+ * Returns 0 if length is too short or has no balanced factorization.
+ */
+static size_t muged_six_step_rows(size_t length)
+{
+	if (length < MUGED_FFT_SIX_STEP_LENGTH)
+		return 0;
+
+	size_t rows = (size_t)sqrt((double)length);
+	while (rows * rows > length)
+		rows--;
+
+	while (length % rows != 0)
+		rows--;
+
+	//Row transforms much longer than columns ones don't fit in cache
+	return 16 * rows >= length / rows ? rows : 0;
+}
+
+void muged_transpose(const muged_scalar* input, size_t rows, size_t columns, muged_scalar* output)
+{
+	muged_transpose(input, rows, columns, columns, output, rows);
+}
+
+void muged_transpose(const muged_scalar* input, size_t rows, size_t columns, size_t input_stride,
+                     muged_scalar* output, size_t output_stride)
+{
+	size_t blocks = (rows + MUGED_TRANSPOSE_BLOCK - 1) / MUGED_TRANSPOSE_BLOCK;
+
+	//Block rows of input
+	muged_parallel_body body = [=](size_t begin, size_t end)
+	{
+		for (size_t block = begin; block < end; block++)
+		{
+			size_t row_begin = block * MUGED_TRANSPOSE_BLOCK;
+			size_t row_end = row_begin + MUGED_TRANSPOSE_BLOCK < rows ? row_begin + MUGED_TRANSPOSE_BLOCK : rows;
+
+			for (size_t column_begin = 0; column_begin < columns; column_begin += MUGED_TRANSPOSE_BLOCK)
+			{
+				size_t column_end = column_begin + MUGED_TRANSPOSE_BLOCK < columns ?
+				                    column_begin + MUGED_TRANSPOSE_BLOCK : columns;
+
+				for (size_t row = row_begin; row < row_end; row++)
+				{
+					for (size_t column = column_begin; column < column_end; column++)
+						output[column * output_stride + row] = input[row * input_stride + column];
+				}
+			}
+		}
+	};
+
+	if (rows * columns >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(blocks, body);
+	else
+		body(0, blocks);
+}
+
+MUGED_FFTPlan::MUGED_FFTPlan(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type,
+                             bool own_scratch)
+{
+	if (length == 0)
+		throw new MUGED_DSPException(ERR_FFT_LENGTH);
+
+	this->length = length;
+	this->direction = direction;
+	this->type = type;
+
+	twiddles = NULL;
+	bit_reversal = NULL;
+	chirp = NULL;
+	chirp_spectrum = NULL;
+	convolution_plan = NULL;
+	column_plan = NULL;
+	row_plan = NULL;
+	complex_plan = NULL;
+	real_twiddles = NULL;
+	scratch = NULL;
+	factors[0] = length;
+	factors[1] = 1;
+
+	if (type == MUGED_FFT_REAL)
+	{
+		//Even length - half length complex transform of packed samples
+		size_t complex_length = length % 2 == 0 ? length/2 : length;
+		complex_plan = new MUGED_FFTPlan(complex_length, direction, MUGED_FFT_COMPLEX, false);
+		algorithm = complex_plan->muged_algorithm();
+
+		if (length % 2 == 0)
+		{
+			double pi = 4 * atan(1);
+			real_twiddles = new muged_scalar[length/2 + 1];
+			for (size_t k = 0; k <= length/2; k++)
+				real_twiddles[k] = muged_scalar(1, direction * 2 * pi * k / length, false);
+		}
+
+		if (own_scratch)
+			scratch = new muged_scalar[muged_scratch_length()];
+		return;
+	}
+
+	double pi = 4 * atan(1);
+	size_t rows = muged_six_step_rows(length);
+
+	if (rows > 0)
+	{
+		algorithm = MUGED_FFT_SIX_STEP;
+
+		size_t columns = length / rows;
+		column_plan = new MUGED_FFTPlan(rows, direction, MUGED_FFT_COMPLEX, false);
+		row_plan = new MUGED_FFTPlan(columns, direction, MUGED_FFT_COMPLEX, false);
+
+		//W_N^m = W_N^(N1*(m/N1)) * W_N^(m%N1), N1+N2 values instead of N
+		twiddles = new muged_scalar[columns + rows];
+		for (size_t j = 0; j < columns; j++)
+			twiddles[j] = muged_scalar(1, direction * 2 * pi * j / columns, false);
+
+		for (size_t j = 0; j < rows; j++)
+			twiddles[columns + j] = muged_scalar(1, direction * 2 * pi * j / length, false);
+	}
+	else if ((length & (length - 1)) == 0)
+	{
+		algorithm = MUGED_FFT_RADIX_2;
+
+		//Bit-reversal indices
+		bit_reversal = new size_t[length];
+		bit_reversal[0] = 0;
+
+		for (size_t i = 1, j = 0; i < length; i++)
+		{
+			size_t bit = length >> 1;
+			for (; j & bit; bit >>= 1)
+				j ^= bit;
+			j ^= bit;
+
+			bit_reversal[i] = j;
+		}
+
+		//Twiddle factors of radix-4 passes, pass of quarter block size h holds
+		//w^j, w^2j and w^3j (j < h), w = e^(direction*2πi/4h)
+		twiddles = new muged_scalar[length];
+		muged_scalar* pass = twiddles;
+
+		for (size_t quarter = muged_first_quarter(); 4 * quarter <= length; quarter <<= 2)
+		{
+			for (size_t power = 1; power <= 3; power++)
+			{
+				for (size_t j = 0; j < quarter; j++)
+					pass[j] = muged_scalar(1, direction * pi * power * j / (2 * quarter), false);
+
+				pass += quarter;
+			}
+		}
+	}
+	else
+	{
+		//Factorization, radix 4 first then 2, 3, 5, 7, ...
+		algorithm = MUGED_FFT_MIXED_RADIX;
+
+		size_t n = length;
+		size_t p = 4;
+
+		for (size_t i = 0; n > 1; i++)
+		{
+			while (n % p)
+			{
+				p = (p == 4) ? 2 : (p == 2) ? 3 : p + 2;
+				if (p * p > n)
+					p = n;
+			}
+
+			if (p > MUGED_FFT_MAX_RADIX)
+			{
+				algorithm = MUGED_FFT_BLUESTEIN;
+				break;
+			}
+
+			n /= p;
+			factors[2*i] = p;
+			factors[2*i + 1] = n;
+		}
+
+		if (algorithm == MUGED_FFT_MIXED_RADIX)
+		{
+			twiddles = new muged_scalar[length];
+			for (size_t k = 0; k < length; k++)
+				twiddles[k] = muged_scalar(1, direction * 2 * pi * k / length, false);
+		}
+		else
+		{
+			//Convolution length - power of two not less than 2N-1
+			size_t M = 1;
+			while (M < 2 * length - 1)
+				M <<= 1;
+
+			convolution_plan = new MUGED_FFTPlan(M, MUGED_FFT_FORWARD);
+
+			//Chirp, n^2 reduced modulo 2N keeps the angle accurate
+			chirp = new muged_scalar[length];
+			for (size_t n = 0; n < length; n++)
+			{
+				unsigned long long square = (unsigned long long)n * n % (2 * length);
+				chirp[n] = muged_scalar(1, direction * pi * square / length, false);
+			}
+
+			//Spectrum of conjugated chirp wrapped around convolution buffer
+			chirp_spectrum = new muged_scalar[M];
+			chirp_spectrum[0] = chirp[0].muged_conj();
+			for (size_t n = 1; n < length; n++)
+			{
+				chirp_spectrum[n] = chirp[n].muged_conj();
+				chirp_spectrum[M - n] = chirp[n].muged_conj();
+			}
+
+			//Own scratch of convolution plan, e.g. six-step plan of long convolution needs it
+			convolution_plan->muged_execute(chirp_spectrum, M, chirp_spectrum);
+
+			for (size_t j = 0; j < M; j++)
+				chirp_spectrum[j] /= M;
+		}
+	}
+
+	if (own_scratch && muged_scratch_length() > 0)
+		scratch = new muged_scalar[muged_scratch_length()];
+}
+
+MUGED_FFTPlan::~MUGED_FFTPlan()
+{
+	delete [] bit_reversal;
+	delete [] twiddles;
+	delete [] chirp;
+	delete [] chirp_spectrum;
+	delete convolution_plan;
+	delete column_plan;
+	delete row_plan;
+	delete complex_plan;
+	delete [] real_twiddles;
+	delete [] scratch;
+}
+
+void MUGED_FFTPlan::muged_execute(const muged_scalar* input, size_t input_length,
+                                  muged_scalar* output, muged_scalar* scratch) const
+{
+	if (type != MUGED_FFT_COMPLEX)
+		throw new MUGED_DSPException(ERR_FFT_TYPE);
+
+	if (input_length > length)
+		input_length = length;
+
+	switch (algorithm)
+	{
+	case MUGED_FFT_RADIX_2:
+		muged_radix_2(input, input_length, output);
+		break;
+
+	case MUGED_FFT_MIXED_RADIX:
+		//Out-of-place algorithm, zero padded or overwritten input goes through scratch
+		if (input == output || input_length < length)
+		{
+			std::copy(input, input + input_length, scratch);
+			for (size_t i = input_length; i < length; i++)
+				scratch[i] = muged_scalar();
+
+			input = scratch;
+		}
+
+		muged_mixed_radix(output, input, 1, factors);
+		break;
+
+	case MUGED_FFT_BLUESTEIN:
+		muged_bluestein(input, input_length, output, scratch);
+		break;
+
+	case MUGED_FFT_SIX_STEP:
+		muged_six_step(input, input_length, output, scratch);
+		break;
+	}
+}
+
+void MUGED_FFTPlan::muged_execute(const muged_scalar* input, size_t input_length, muged_scalar* output)
+{
+	if (scratch == NULL && muged_scratch_length() > 0)
+		throw new MUGED_DSPException(ERR_FFT_SCRATCH);
+
+	muged_execute(input, input_length, output, scratch);
+}
+
+void MUGED_FFTPlan::muged_execute_batch(const muged_scalar* input, size_t stride, size_t distance, size_t count,
+                                        muged_scalar* output, muged_scalar* scratch) const
+{
+	for (size_t signal = 0; signal < count; signal++)
+	{
+		const muged_scalar* signal_input = input + signal * distance;
+		muged_scalar* signal_output = output + signal * length;
+
+		if (stride == 1)
+		{
+			muged_execute(signal_input, length, signal_output, scratch);
+		}
+		else
+		{
+			for (size_t n = 0; n < length; n++)
+				signal_output[n] = signal_input[n * stride];
+
+			muged_execute(signal_output, length, signal_output, scratch);
+		}
+	}
+}
+
+void MUGED_FFTPlan::muged_execute_real(const double* input, size_t input_length,
+                                       muged_scalar* output, muged_scalar* scratch) const
+{
+	if (type != MUGED_FFT_REAL || direction != MUGED_FFT_FORWARD)
+		throw new MUGED_DSPException(ERR_FFT_TYPE);
+
+	if (input_length > length)
+		input_length = length;
+
+	size_t M = complex_plan->muged_length();
+	muged_scalar* complex_scratch = scratch + M;
+
+	if (length % 2 != 0)
+	{
+		//Odd length - complex transform, first half of spectrum is kept
+		for (size_t n = 0; n < M; n++)
+			scratch[n] = muged_scalar(n < input_length ? input[n] : 0, 0);
+
+		complex_plan->muged_execute(scratch, M, scratch, complex_scratch);
+		std::copy(scratch, scratch + length/2 + 1, output);
+
+		return;
+	}
+
+	//z_n = x_2n + i*x_2n+1, transformed in place in output
+	for (size_t n = 0; n < M; n++)
+	{
+		double even_sample = 2*n < input_length ? input[2*n] : 0;
+		double odd_sample = 2*n + 1 < input_length ? input[2*n + 1] : 0;
+		output[n] = muged_scalar(even_sample, odd_sample);
+	}
+
+	complex_plan->muged_execute(output, M, output, complex_scratch);
+
+	//X_k = E_k + W^k*O_k, E_k = (Z_k + conj(Z_M-k))/2, O_k = (Z_k - conj(Z_M-k))/2i
+	//Bins k and M-k use the same pair of values, so both are calculated at once
+	for (size_t k = 0; k <= M/2; k++)
+	{
+		size_t j = M - k;
+
+		muged_scalar z_k = output[k];
+		muged_scalar z_j = output[j % M];
+
+		for (size_t pass = 0; pass < 2; pass++)
+		{
+			size_t bin = pass == 0 ? k : j;
+			const muged_scalar& z = pass == 0 ? z_k : z_j;
+			const muged_scalar& z_mirror = pass == 0 ? z_j : z_k;
+
+			double even_real = (z.muged_real() + z_mirror.muged_real()) / 2;
+			double even_imag = (z.muged_imag() - z_mirror.muged_imag()) / 2;
+			double odd_real = (z.muged_imag() + z_mirror.muged_imag()) / 2;
+			double odd_imag = (z_mirror.muged_real() - z.muged_real()) / 2;
+
+			const muged_scalar& w = real_twiddles[bin];
+			output[bin] = muged_scalar(even_real + w.muged_real() * odd_real - w.muged_imag() * odd_imag,
+			                           even_imag + w.muged_real() * odd_imag + w.muged_imag() * odd_real);
+		}
+	}
+}
+
+void MUGED_FFTPlan::muged_execute_real(const muged_scalar* input, double* output, muged_scalar* scratch) const
+{
+	if (type != MUGED_FFT_REAL || direction != MUGED_FFT_INVERSE)
+		throw new MUGED_DSPException(ERR_FFT_TYPE);
+
+	size_t M = complex_plan->muged_length();
+	muged_scalar* complex_scratch = scratch + M;
+
+	if (length % 2 != 0)
+	{
+		//Odd length - full spectrum restored from Hermitian symmetry
+		for (size_t k = 0; k <= length/2; k++)
+		{
+			muged_scalar bin = input[k];
+			scratch[k] = bin;
+			if (k > 0)
+				scratch[length - k] = bin.muged_conj();
+		}
+
+		complex_plan->muged_execute(scratch, M, scratch, complex_scratch);
+
+		for (size_t n = 0; n < length; n++)
+			output[n] = scratch[n].muged_real();
+
+		return;
+	}
+
+	//Z_k = E_k + i*O_k, E_k = X_k + conj(X_M-k), O_k = (X_k - conj(X_M-k))*W^-k
+	for (size_t k = 0; k < M; k++)
+	{
+		const muged_scalar& x = input[k];
+		const muged_scalar& x_mirror = input[M - k];
+
+		double even_real = x.muged_real() + x_mirror.muged_real();
+		double even_imag = x.muged_imag() - x_mirror.muged_imag();
+		double diff_real = x.muged_real() - x_mirror.muged_real();
+		double diff_imag = x.muged_imag() + x_mirror.muged_imag();
+
+		const muged_scalar& w = real_twiddles[k];
+		double odd_real = diff_real * w.muged_real() - diff_imag * w.muged_imag();
+		double odd_imag = diff_real * w.muged_imag() + diff_imag * w.muged_real();
+
+		scratch[k] = muged_scalar(even_real - odd_imag, even_imag + odd_real);
+	}
+
+	complex_plan->muged_execute(scratch, M, scratch, complex_scratch);
+
+	for (size_t n = 0; n < M; n++)
+	{
+		output[2*n] = scratch[n].muged_real();
+		output[2*n + 1] = scratch[n].muged_imag();
+	}
+}
+
+void MUGED_FFTPlan::muged_radix_2(const muged_scalar* input, size_t input_length, muged_scalar* output) const
+{
+	size_t N = length;
+
+	if (input == output)
+	{
+		//In-place zero padding and bit-reversal permutation
+		for (size_t i = input_length; i < N; i++)
+			output[i] = muged_scalar();
+
+		for (size_t i = 0; i < N; i++)
+		{
+			size_t index = bit_reversal[i];
+			if (i < index)
+			{
+				muged_scalar swap = output[i];
+				output[i] = output[index];
+				output[index] = swap;
+			}
+		}
+	}
+	else
+	{
+		//Bit-reversal permutation and zero padding
+		for (size_t i = 0; i < N; i++)
+		{
+			size_t index = bit_reversal[i];
+			output[i] = index < input_length ? input[index] : muged_scalar();
+		}
+	}
+
+	//Odd number of radix-2 stages - the first one is calculated separately
+	size_t quarter = muged_first_quarter();
+	if (quarter == 2)
+	{
+		static const muged_scalar one = muged_scalar(1, 0);
+		muged_radix_2_stage(1)(output, N, 1, &one);
+	}
+
+	//Radix-4 passes (two radix-2 stages each), vectorized for instruction set of current CPU
+	const muged_scalar* pass = twiddles;
+	for (; 4 * quarter <= N; quarter <<= 2)
+	{
+		muged_radix_4_pass(quarter)(output, N, quarter, pass, direction);
+		pass += 3 * quarter;
+	}
+}
+
+size_t MUGED_FFTPlan::muged_first_quarter() const
+{
+	size_t stages = 0;
+	while (((size_t)1 << stages) < length)
+		stages++;
+
+	return stages % 2 == 0 ? 1 : 2;
+}
+
+void MUGED_FFTPlan::muged_mixed_radix(muged_scalar* output, const muged_scalar* input,
+                                      size_t stride, const size_t* factors) const
+{
+	size_t p = factors[0];
+	size_t m = factors[1];
+	muged_scalar* output_end = output + p * m;
+
+	if (m == 1)
+	{
+		for (muged_scalar* sample = output; sample != output_end; sample++, input += stride)
+			*sample = *input;
+	}
+	else
+	{
+		//p transforms of length m, each taking every p-th sample
+		for (muged_scalar* part = output; part != output_end; part += m, input += stride)
+			muged_mixed_radix(part, input, stride * p, factors + 2);
+	}
+
+	switch (p)
+	{
+	case 2:
+		muged_butterfly_2(output, stride, twiddles, m);
+		break;
+	case 4:
+		muged_butterfly_4(output, stride, twiddles, m, direction);
+		break;
+	default:
+		muged_butterfly_odd(output, stride, twiddles, m, p);
+		break;
+	}
+}
+
+void MUGED_FFTPlan::muged_six_step(const muged_scalar* input, size_t input_length,
+                                   muged_scalar* output, muged_scalar* scratch) const
+{
+	size_t rows = column_plan->muged_length();
+	size_t columns = row_plan->muged_length();
+	const muged_scalar* coarse = twiddles;
+	const muged_scalar* fine = twiddles + columns;
+
+	if (input_length < length)
+	{
+		if (input != output)
+			std::copy(input, input + input_length, output);
+
+		for (size_t i = input_length; i < length; i++)
+			output[i] = muged_scalar();
+
+		input = output;
+	}
+
+	//1. Columns of N1 x N2 input become rows of scratch
+	muged_transpose(input, rows, columns, scratch);
+
+	//Every part of work has its own scratch behind the matrix, nothing is allocated
+	size_t parts = muged_thread_count() < MUGED_FFT_SIX_STEP_PARTS ? muged_thread_count() : MUGED_FFT_SIX_STEP_PARTS;
+	size_t column_parts = parts < columns ? parts : columns;
+	size_t row_parts = parts < rows ? parts : rows;
+	size_t part_length = muged_six_step_part_length();
+	muged_scalar* part_scratch = scratch + length;
+
+	//2-3. Transforms of length N1, each multiplied by W_N^(n2*k1) while still in cache
+	muged_parallel_for(column_parts, [=](size_t begin, size_t end)
+	{
+		for (size_t part = begin; part < end; part++)
+		{
+			muged_scalar* column_scratch = part_length > 0 ? part_scratch + part * part_length : NULL;
+
+			for (size_t n2 = part * columns / column_parts; n2 < (part + 1) * columns / column_parts; n2++)
+			{
+				muged_scalar* column = scratch + n2 * rows;
+				column_plan->muged_execute(column, rows, column, column_scratch);
+
+				//m = n2*k1 kept as quotient and remainder of division by N1
+				size_t step_quotient = n2 / rows;
+				size_t step_remainder = n2 % rows;
+				size_t quotient = 0;
+				size_t remainder = 0;
+
+				for (size_t k1 = 1; k1 < rows; k1++)
+				{
+					quotient += step_quotient;
+					remainder += step_remainder;
+					if (remainder >= rows)
+					{
+						remainder -= rows;
+						quotient++;
+					}
+
+					muged_scalar w = coarse[quotient] * fine[remainder];
+					column[k1] = column[k1] * w;
+				}
+			}
+		}
+	});
+
+	//4. Back to N1 x N2
+	muged_transpose(scratch, columns, rows, output);
+
+	//5. Transforms of length N2 written to scratch
+	muged_parallel_for(row_parts, [=](size_t begin, size_t end)
+	{
+		for (size_t part = begin; part < end; part++)
+		{
+			muged_scalar* row_scratch = part_length > 0 ? part_scratch + part * part_length : NULL;
+
+			for (size_t k1 = part * rows / row_parts; k1 < (part + 1) * rows / row_parts; k1++)
+				row_plan->muged_execute(output + k1 * columns, columns, scratch + k1 * columns, row_scratch);
+		}
+	});
+
+	//6. X_k1+N1*k2 is element (k1, k2) of scratch
+	muged_transpose(scratch, rows, columns, output);
+}
+
+void MUGED_FFTPlan::muged_bluestein(const muged_scalar* input, size_t input_length,
+                                    muged_scalar* output, muged_scalar* scratch) const
+{
+	size_t M = convolution_plan->muged_length();
+
+	//a_n = x_n * w_n
+	for (size_t n = 0; n < input_length; n++)
+		scratch[n] = input[n] * chirp[n];
+
+	for (size_t n = input_length; n < M; n++)
+		scratch[n] = muged_scalar();
+
+	//Convolution with conjugated chirp, inverse transform as conj(FFT(conj(A))),
+	//scratch of convolution plan follows the M samples
+	muged_scalar* convolution_scratch = scratch + M;
+	convolution_plan->muged_execute(scratch, M, scratch, convolution_scratch);
+
+	for (size_t j = 0; j < M; j++)
+		scratch[j] = (scratch[j] * chirp_spectrum[j]).muged_conj();
+
+	convolution_plan->muged_execute(scratch, M, scratch, convolution_scratch);
+
+	//X_k = w_k * conv_k
+	for (size_t k = 0; k < length; k++)
+		output[k] = chirp[k] * scratch[k].muged_conj();
+}
+
+size_t MUGED_FFTPlan::muged_memory_size() const
+{
+	size_t size = sizeof(MUGED_FFTPlan) + (scratch != NULL ? muged_scratch_length() * sizeof(muged_scalar) : 0);
+
+	if (type == MUGED_FFT_REAL)
+		return size + (real_twiddles != NULL ? (length/2 + 1) * sizeof(muged_scalar) : 0)
+		       + complex_plan->muged_memory_size();
+
+	switch (algorithm)
+	{
+	case MUGED_FFT_RADIX_2:
+		size += length * sizeof(muged_scalar) + length * sizeof(size_t);
+		break;
+	case MUGED_FFT_MIXED_RADIX:
+		size += length * sizeof(muged_scalar);
+		break;
+	case MUGED_FFT_BLUESTEIN:
+		size += (length + convolution_plan->muged_length()) * sizeof(muged_scalar)
+		        + convolution_plan->muged_memory_size();
+		break;
+	case MUGED_FFT_SIX_STEP:
+		size += (column_plan->muged_length() + row_plan->muged_length()) * sizeof(muged_scalar)
+		        + column_plan->muged_memory_size() + row_plan->muged_memory_size();
+		break;
+	}
+
+	return size;
+}
@@ -0,0 +1,113 @@
+#include "MUGED_FFTPlanCache.h"
+
+MUGED_FFTPlanCache::MUGED_FFTPlanCache(size_t max_plans, size_t max_bytes)
+	: plans(0), bytes(0), hits(0), misses(0), full_logged(false)
+{
+	this->max_plans = max_plans;
+	this->max_bytes = max_bytes;
+
+	//Keep table at most half full, probing stays short
+	capacity = 1;
+	while (capacity < 2 * max_plans)
+		capacity <<= 1;
+
+	slots = new std::atomic<MUGED_FFTPlan*>[capacity];
+	for (size_t i = 0; i < capacity; i++)
+		slots[i].store(NULL, std::memory_order_relaxed);
+}
+
+MUGED_FFTPlanCache::~MUGED_FFTPlanCache()
+{
+	for (size_t i = 0; i < capacity; i++)
+		delete slots[i].load(std::memory_order_relaxed);
+
+	delete [] slots;
+}
+
+const MUGED_FFTPlan* MUGED_FFTPlanCache::muged_find(size_t length, MUGED_FFTDirection direction, MUGED_FFTType type,
+                                                    MUGED_FFTPrecision precision, size_t& slot) const
+{
+	size_t hash = (length * 2654435761u) ^ ((size_t)(direction + 1) << 1) ^ ((size_t)type << 2) ^ (size_t)precision;
+
+	for (size_t probe = 0; probe < capacity; probe++)
+	{
+		slot = (hash + probe) & (capacity - 1);
+
+		const MUGED_FFTPlan* plan = slots[slot].load(std::memory_order_acquire);
+
+		//Plans are never removed, empty slot ends the search
+		if (plan == NULL)
+			return NULL;
+
+		if (plan->muged_length() == length && plan->muged_direction() == direction
+		    && plan->muged_type() == type && plan->muged_precision() == precision)
+			return plan;
+	}
+
+	slot = capacity;
+	return NULL;
+}
+
+const MUGED_FFTPlan* MUGED_FFTPlanCache::muged_plan(size_t length, MUGED_FFTDirection direction, bool& owned,
+                                                    MUGED_FFTType type, MUGED_FFTPrecision precision)
+{
+	size_t slot;
+	owned = false;
+
+	//Hot path without locking
+	const MUGED_FFTPlan* plan = muged_find(length, direction, type, precision, slot);
+	if (plan != NULL)
+	{
+		hits.fetch_add(1, std::memory_order_relaxed);
+		return plan;
+	}
+
+	misses.fetch_add(1, std::memory_order_relaxed);
+
+	MUGED_FFTPlan* created = NULL;
+
+	//Limits are checked first, full cache doesn't build plans it can't store
+	if (slot < capacity && plans.load(std::memory_order_relaxed) < max_plans
+	    && bytes.load(std::memory_order_relaxed) < max_bytes)
+	{
+		//Built without lock, threads missing the same plan race to publish it
+		created = new MUGED_FFTPlan(length, direction, type, false);
+		size_t created_bytes = created->muged_memory_size();
+
+		//Both limits are reserved before publishing and released if plan is not stored
+		size_t stored_plans = plans.fetch_add(1, std::memory_order_relaxed);
+		size_t stored_bytes = bytes.fetch_add(created_bytes, std::memory_order_relaxed);
+
+		if (stored_plans < max_plans && stored_bytes + created_bytes <= max_bytes)
+		{
+			while (slot < capacity)
+			{
+				MUGED_FFTPlan* empty = NULL;
+				if (slots[slot].compare_exchange_strong(empty, created, std::memory_order_acq_rel,
+				                                        std::memory_order_acquire))
+					return created;
+
+				//Slot taken by other thread, possibly with the same plan
+				plan = muged_find(length, direction, type, precision, slot);
+				if (plan != NULL)
+				{
+					plans.fetch_sub(1, std::memory_order_relaxed);
+					bytes.fetch_sub(created_bytes, std::memory_order_relaxed);
+					delete created;
+					return plan;
+				}
+			}
+		}
+
+		plans.fetch_sub(1, std::memory_order_relaxed);
+		bytes.fetch_sub(created_bytes, std::memory_order_relaxed);
+	}
+
+	if (!full_logged.exchange(true, std::memory_order_relaxed))
+	{
+		INFO("FFT plan cache is full, plan of length %zu and further ones are not stored", length);
+	}
+
+	owned = true;
+	return created != NULL ? created : new MUGED_FFTPlan(length, direction, type, false);
+}
@@ -0,0 +1,54 @@
+#include <new>
+#include <stdint.h>
+
+#include "MUGED_Memory.h"
+
+void* muged_aligned_alloc(size_t bytes)
+{
+	//Block is over-allocated, address returned by malloc is kept just before aligned one
+	void* block = malloc(bytes + MUGED_ALIGNMENT + sizeof(void*));
+	if (block == NULL)
+		throw std::bad_alloc();
+
+	uintptr_t address = (uintptr_t)block + sizeof(void*);
+	address = (address + MUGED_ALIGNMENT - 1) & ~(uintptr_t)(MUGED_ALIGNMENT - 1);
+
+	((void**)address)[-1] = block;
+	return (void*)address;
+}
+
+void muged_aligned_free(void* memory)
+{
+	if (memory != NULL)
+		free(((void**)memory)[-1]);
+}
+
+void muged_split_allocate(muged_split_array& array, size_t length, bool complex)
+{
+	array.length = length;
+	array.real = (double*)muged_aligned_alloc(length * sizeof(double));
+	array.imag = NULL;
+
+	if (complex)
+	{
+		try
+		{
+			array.imag = (double*)muged_aligned_alloc(length * sizeof(double));
+		}
+		catch (...)
+		{
+			muged_aligned_free(array.real);
+			throw;
+		}
+	}
+}
+
+void muged_split_free(muged_split_array& array)
+{
+	muged_aligned_free(array.real);
+	muged_aligned_free(array.imag);
+
+	array.real = NULL;
+	array.imag = NULL;
+	array.length = 0;
+}
@@ -0,0 +1,180 @@
+#include "MUGED_MovingStatistics.h"
+
+MUGED_MovingStatistics::MUGED_MovingStatistics(size_t window)
+{
+	if (window == 0)
+		throw new MUGED_DSPException(ERR_WINDOW_LENGTH);
+
+	this->samples = MUGED_Array(window, MUGED_UNINITIALIZED);
+	muged_reset();
+}
+
+void MUGED_MovingStatistics::muged_add(const muged_scalar& sample) noexcept
+{
+	size_t window = this->samples.muged_length();
+
+	//First sample is the shift until mean of window is known
+	if (this->count == 0)
+	{
+		this->shift_real = sample.muged_real();
+		this->shift_imag = sample.muged_imag();
+	}
+
+	double a = sample.muged_real() - this->shift_real;
+	double b = sample.muged_imag() - this->shift_imag;
+
+	if (this->count == window)
+	{
+		const muged_scalar& oldest = this->samples[this->position];
+		double old_a = oldest.muged_real() - this->shift_real;
+		double old_b = oldest.muged_imag() - this->shift_imag;
+
+		this->real -= old_a;
+		this->imag -= old_b;
+		this->real_real -= old_a * old_a;
+		this->imag_imag -= old_b * old_b;
+		this->real_imag -= old_a * old_b;
+	}
+	else
+	{
+		this->count++;
+	}
+
+	this->samples[this->position] = sample;
+
+	this->real += a;
+	this->imag += b;
+	this->real_real += a * a;
+	this->imag_imag += b * b;
+	this->real_imag += a * b;
+
+	//Once per window sums start again without error of subtractions
+	if (++this->position == window)
+	{
+		this->position = 0;
+		muged_resum();
+	}
+}
+
+void MUGED_MovingStatistics::muged_resum() noexcept
+{
+	//Mean of window becomes the shift, deviations from it don't cancel
+	double shift_real = this->shift_real + this->real / this->count;
+	double shift_imag = this->shift_imag + this->imag / this->count;
+
+	const double* values = muged_as_doubles(this->samples.muged_data());
+	double real = 0, imag = 0, real_real = 0, imag_imag = 0, real_imag = 0;
+
+	for (size_t i = 0; i < this->count; i++)
+	{
+		double a = values[2 * i] - shift_real;
+		double b = values[2 * i + 1] - shift_imag;
+
+		real += a;
+		imag += b;
+		real_real += a * a;
+		imag_imag += b * b;
+		real_imag += a * b;
+	}
+
+	this->shift_real = shift_real;
+	this->shift_imag = shift_imag;
+	this->real = real;
+	this->imag = imag;
+	this->real_real = real_real;
+	this->imag_imag = imag_imag;
+	this->real_imag = real_imag;
+}
+
+void MUGED_MovingStatistics::muged_reset() noexcept
+{
+	this->position = 0;
+	this->count = 0;
+	this->shift_real = 0;
+	this->shift_imag = 0;
+	this->real = 0;
+	this->imag = 0;
+	this->real_real = 0;
+	this->imag_imag = 0;
+	this->real_imag = 0;
+}
+
+size_t MUGED_MovingStatistics::muged_window() const noexcept
+{
+	return this->samples.muged_length();
+}
+
+size_t MUGED_MovingStatistics::muged_count() const noexcept
+{
+	return this->count;
+}
+
+muged_scalar MUGED_MovingStatistics::muged_mean() const noexcept
+{
+	return muged_scalar(this->shift_real + this->real / this->count, this->shift_imag + this->imag / this->count);
+}
+
+muged_scalar MUGED_MovingStatistics::muged_mean_square() const noexcept
+{
+	//z = c + d: E[z^2] = c^2 + 2cE[d] + E[d^2], d^2 = (a^2 - b^2) + 2abi
+	muged_scalar shift(this->shift_real, this->shift_imag);
+	muged_scalar deviation = muged_scalar(this->real, this->imag) / this->count;
+	muged_scalar deviation_square = muged_scalar(this->real_real - this->imag_imag, 2 * this->real_imag) / this->count;
+
+	return shift * shift + muged_scalar(2, 0) * shift * deviation + deviation_square;
+}
+
+muged_scalar MUGED_MovingStatistics::muged_root_mean_square() const noexcept
+{
+	//|z|^2 = |c|^2 + 2Re(conj(c)d) + |d|^2, subtraction may leave tiny negative sum of zeros
+	double mean_norm = this->shift_real * this->shift_real + this->shift_imag * this->shift_imag
+	                   + 2 * (this->shift_real * this->real + this->shift_imag * this->imag) / this->count
+	                   + (this->real_real + this->imag_imag) / this->count;
+
+	return muged_scalar(mean_norm > 0 ? mean_norm : 0, 0).muged_sqrt();
+}
+
+muged_scalar MUGED_MovingStatistics::muged_standard_deviation() const noexcept
+{
+	//Shift cancels out, variance is calculated from deviations only
+	muged_scalar deviation = muged_scalar(this->real, this->imag) / this->count;
+	muged_scalar deviation_square = muged_scalar(this->real_real - this->imag_imag, 2 * this->real_imag) / this->count;
+
+	return ( deviation_square - deviation.muged_pow() ).muged_sqrt();
+}
+
+size_t MUGED_MovingStatistics::muged_mean_into(const muged_array& input, muged_array& output)
+{
+	return muged_process(input, output, &MUGED_MovingStatistics::muged_mean);
+}
+
+size_t MUGED_MovingStatistics::muged_mean_square_into(const muged_array& input, muged_array& output)
+{
+	return muged_process(input, output, &MUGED_MovingStatistics::muged_mean_square);
+}
+
+size_t MUGED_MovingStatistics::muged_root_mean_square_into(const muged_array& input, muged_array& output)
+{
+	return muged_process(input, output, &MUGED_MovingStatistics::muged_root_mean_square);
+}
+
+size_t MUGED_MovingStatistics::muged_standard_deviation_into(const muged_array& input, muged_array& output)
+{
+	return muged_process(input, output, &MUGED_MovingStatistics::muged_standard_deviation);
+}
+
+size_t MUGED_MovingStatistics::muged_process(const muged_array& input, muged_array& output,
+                                             muged_scalar (MUGED_MovingStatistics::*statistic)() const)
+{
+	if (output.length < input.length)
+		throw new MUGED_DSPException(ERR_ARRAY_LENGTH);
+
+	//Sample is read before output overwrites it
+	for (size_t i = 0; i < input.length; i++)
+	{
+		muged_add(input.array[i]);
+		output.array[i] = (this->*statistic)();
+	}
+
+	return input.length;
+}
@@ -0,0 +1,245 @@
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "MUGED_Parallel.h"
+
+/**
+ * @struct muged_parallel_loop
+ * @brief State of one parallel loop, lives on the stack of calling thread
+ */
+struct muged_parallel_loop
+{
+	const muged_parallel_body* body;
+	size_t count;
+	size_t ranges;
+
+	/// Next range to process
+	std::atomic<size_t> next;
+
+	/// Ranges not finished yet (guarded by pool mutex)
+	size_t pending;
+
+	/// Exception of every range
+	std::vector<std::exception_ptr> errors;
+};
+
+/// Set while thread runs body of a loop, loop nested in it runs serially
+static thread_local bool muged_in_loop = false;
+
+/**
+ * @class MUGED_ThreadPool
+ * @brief Worker threads kept alive between parallel loops.
+ *
+ * Loop is split into ranges taken by workers and calling thread from shared
+ * counter. Pool runs one loop at a time, concurrent loop is refused. Nested loop
+ * never reaches the pool, as the thread may already hold it.
+ */
+class MUGED_ThreadPool
+{
+public:
+
+	MUGED_ThreadPool()
+	{
+		stop = false;
+		generation = 0;
+		loop = NULL;
+		active = 0;
+	}
+
+	~MUGED_ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+
+		wake.notify_all();
+
+		for (size_t t = 0; t < workers.size(); t++)
+			workers[t].join();
+	}
+
+	/**
+	 * @fn muged_run(size_t count, size_t threads, const muged_parallel_body& body)
+	 *
+	 * Runs loop on threads (including calling one)
+	 *
+	 * @return bool - false if pool is already running other loop
+	 */
+	bool muged_run(size_t count, size_t threads, const muged_parallel_body& body)
+	{
+		std::unique_lock<std::mutex> running(busy, std::try_to_lock);
+		if (!running.owns_lock())
+			return false;
+
+		while (workers.size() + 1 < threads)
+			workers.push_back(std::thread(&MUGED_ThreadPool::muged_work, this));
+
+		muged_parallel_loop current;
+		current.body = &body;
+		current.count = count;
+		current.ranges = threads;
+		current.next.store(0);
+		current.pending = threads;
+		current.errors.resize(threads);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			loop = &current;
+			generation++;
+		}
+
+		wake.notify_all();
+		muged_process(current);
+
+		//Loop is withdrawn when no worker uses it any more
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			while (current.pending > 0 || active > 0)
+				done.wait(lock);
+
+			loop = NULL;
+		}
+
+		for (size_t t = 0; t < current.errors.size(); t++)
+		{
+			if (current.errors[t])
+				std::rethrow_exception(current.errors[t]);
+		}
+
+		return true;
+	}
+
+private:
+
+	/**
+	 * Processes ranges of loop until all of them are taken
+	 */
+	void muged_process(muged_parallel_loop& current)
+	{
+		for (;;)
+		{
+			size_t range = current.next.fetch_add(1);
+			if (range >= current.ranges)
+				break;
+
+			muged_in_loop = true;
+
+			try
+			{
+				(*current.body)(range * current.count / current.ranges,
+				                (range + 1) * current.count / current.ranges);
+			}
+			catch (...)
+			{
+				current.errors[range] = std::current_exception();
+			}
+
+			muged_in_loop = false;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--current.pending == 0)
+				done.notify_all();
+		}
+	}
+
+	/**
+	 * Worker thread, waits for next loop
+	 */
+	void muged_work()
+	{
+		size_t seen = 0;
+
+		for (;;)
+		{
+			muged_parallel_loop* current;
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				while (!stop && generation == seen)
+					wake.wait(lock);
+
+				if (stop)
+					return;
+
+				seen = generation;
+				current = loop;
+				if (current == NULL)
+					continue;
+
+				active++;
+			}
+
+			muged_process(*current);
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--active == 0)
+				done.notify_all();
+		}
+	}
+
+	/// Held by thread running a loop
+	std::mutex busy;
+
+	/// Guards pool state below and pending ranges of loop
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+
+	std::vector<std::thread> workers;
+	bool stop;
+	size_t generation;
+
+	/// Loop being run, NULL between loops
+	muged_parallel_loop* loop;
+
+	/// Number of workers processing the loop
+	size_t active;
+};
+
+/// Thread count set by user, 0 means number of hardware threads
+static std::atomic<size_t> muged_threads(0);
+
+size_t muged_thread_count()
+{
+	size_t count = muged_threads.load(std::memory_order_relaxed);
+	if (count > 0)
+		return count;
+
+	count = std::thread::hardware_concurrency();
+	return count > 0 ? count : 1;
+}
+
+void muged_set_thread_count(size_t count)
+{
+	muged_threads.store(count, std::memory_order_relaxed);
+}
+
+void muged_parallel_for(size_t count, const muged_parallel_body& body)
+{
+	static MUGED_ThreadPool pool;
+
+	//Loop nested in body of other loop keeps its thread
+	if (muged_in_loop)
+	{
+		if (count > 0)
+			body(0, count);
+
+		return;
+	}
+
+	size_t threads = muged_thread_count();
+	if (threads > count)
+		threads = count;
+
+	//Single thread, or pool busy with loop of other thread
+	if (threads <= 1 || !pool.muged_run(count, threads, body))
+	{
+		if (count > 0)
+			body(0, count);
+	}
+}
@@ -0,0 +1,836 @@
+#include <atomic>
+
+#include "MUGED_SIMD.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MUGED_SIMD_X86
+#include <immintrin.h>
+#endif
+
+static void muged_radix_2_stage_scalar(muged_scalar* data, size_t length, size_t half,
+                                       const muged_scalar* twiddles)
+{
+	for (size_t block = 0; block < length; block += 2 * half)
+	{
+		muged_scalar* even_part = data + block;
+		muged_scalar* odd_part = even_part + half;
+
+		for (size_t k = 0; k < half; k++)
+		{
+			double w_real = twiddles[k].muged_real();
+			double w_imag = twiddles[k].muged_imag();
+
+			double odd_real = odd_part[k].muged_real();
+			double odd_imag = odd_part[k].muged_imag();
+
+			double t_real = w_real * odd_real - w_imag * odd_imag;
+			double t_imag = w_real * odd_imag + w_imag * odd_real;
+
+			double even_real = even_part[k].muged_real();
+			double even_imag = even_part[k].muged_imag();
+
+			even_part[k] = muged_scalar(even_real + t_real, even_imag + t_imag);
+			odd_part[k]  = muged_scalar(even_real - t_real, even_imag - t_imag);
+		}
+	}
+}
+
+static void muged_radix_4_pass_scalar(muged_scalar* data, size_t length, size_t quarter,
+                                      const muged_scalar* twiddles, double direction)
+{
+	const muged_scalar* w1 = twiddles;
+	const muged_scalar* w2 = w1 + quarter;
+	const muged_scalar* w3 = w2 + quarter;
+
+	for (size_t block = 0; block < length; block += 4 * quarter)
+	{
+		muged_scalar* x0 = data + block;
+		muged_scalar* x1 = x0 + quarter;
+		muged_scalar* x2 = x1 + quarter;
+		muged_scalar* x3 = x2 + quarter;
+
+		for (size_t j = 0; j < quarter; j++)
+		{
+			//First radix-2 stage twiddle w^2j, second stage w^j and w^j+h = direction*i*w^j
+			double t_real = w2[j].muged_real() * x1[j].muged_real() - w2[j].muged_imag() * x1[j].muged_imag();
+			double t_imag = w2[j].muged_real() * x1[j].muged_imag() + w2[j].muged_imag() * x1[j].muged_real();
+
+			double p_real = w1[j].muged_real() * x2[j].muged_real() - w1[j].muged_imag() * x2[j].muged_imag();
+			double p_imag = w1[j].muged_real() * x2[j].muged_imag() + w1[j].muged_imag() * x2[j].muged_real();
+
+			double q_real = w3[j].muged_real() * x3[j].muged_real() - w3[j].muged_imag() * x3[j].muged_imag();
+			double q_imag = w3[j].muged_real() * x3[j].muged_imag() + w3[j].muged_imag() * x3[j].muged_real();
+
+			double a0_real = x0[j].muged_real() + t_real;
+			double a0_imag = x0[j].muged_imag() + t_imag;
+			double a1_real = x0[j].muged_real() - t_real;
+			double a1_imag = x0[j].muged_imag() - t_imag;
+
+			double u_real = p_real + q_real;
+			double u_imag = p_imag + q_imag;
+			double v_real = -direction * (p_imag - q_imag);
+			double v_imag = direction * (p_real - q_real);
+
+			x0[j] = muged_scalar(a0_real + u_real, a0_imag + u_imag);
+			x2[j] = muged_scalar(a0_real - u_real, a0_imag - u_imag);
+			x1[j] = muged_scalar(a1_real + v_real, a1_imag + v_imag);
+			x3[j] = muged_scalar(a1_real - v_real, a1_imag - v_imag);
+		}
+	}
+}
+
+static void muged_deinterleave_scalar(const muged_scalar* input, size_t length, double* real, double* imag)
+{
+	for (size_t i = 0; i < length; i++)
+		real[i] = input[i].muged_real();
+
+	if (imag != NULL)
+	{
+		for (size_t i = 0; i < length; i++)
+			imag[i] = input[i].muged_imag();
+	}
+}
+
+static void muged_interleave_scalar(const double* real, const double* imag, size_t length, muged_scalar* output)
+{
+	for (size_t i = 0; i < length; i++)
+		output[i] = muged_scalar(real[i], imag != NULL ? imag[i] : 0);
+}
+
+static double muged_sum_scalar(const double* values, size_t length)
+{
+	//Independent partial sums, one dependency chain would limit throughput
+	double sums[4] = { 0, 0, 0, 0 };
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		sums[0] += values[i];
+		sums[1] += values[i + 1];
+		sums[2] += values[i + 2];
+		sums[3] += values[i + 3];
+	}
+
+	for (; i < length; i++)
+		sums[0] += values[i];
+
+	return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+static double muged_dot_scalar(const double* first, const double* second, size_t length)
+{
+	double sums[4] = { 0, 0, 0, 0 };
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		sums[0] += first[i] * second[i];
+		sums[1] += first[i + 1] * second[i + 1];
+		sums[2] += first[i + 2] * second[i + 2];
+		sums[3] += first[i + 3] * second[i + 3];
+	}
+
+	for (; i < length; i++)
+		sums[0] += first[i] * second[i];
+
+	return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+static void muged_moments_scalar(const muged_scalar* samples, size_t length, muged_moments& moments)
+{
+	const double* values = muged_as_doubles(samples);
+
+	moments.real = 0;
+	moments.imag = 0;
+	moments.real_real = 0;
+	moments.imag_imag = 0;
+	moments.real_imag = 0;
+	moments.min_norm = HUGE_VAL;
+	moments.max_norm = 0;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		double a = values[2 * i];
+		double b = values[2 * i + 1];
+		double norm = a * a + b * b;
+
+		moments.real += a;
+		moments.imag += b;
+		moments.real_real += a * a;
+		moments.imag_imag += b * b;
+		moments.real_imag += a * b;
+
+		if (norm < moments.min_norm)
+			moments.min_norm = norm;
+		if (norm > moments.max_norm)
+			moments.max_norm = norm;
+	}
+}
+
+/**
+ * Joins lanes of vector accumulators (even lanes hold real parts, odd lanes
+ * imaginary parts) with moments of remaining samples
+ */
+static void muged_reduce_moments(const double* sum, const double* square, const double* cross,
+                                 const double* low, const double* high, size_t width, muged_moments& moments)
+{
+	muged_moments lanes = { 0, 0, 0, 0, 0, HUGE_VAL, 0 };
+
+	for (size_t i = 0; i < width; i += 2)
+	{
+		lanes.real += sum[i];
+		lanes.imag += sum[i + 1];
+		lanes.real_real += square[i];
+		lanes.imag_imag += square[i + 1];
+		lanes.real_imag += cross[i];
+	}
+
+	for (size_t i = 0; i < width; i++)
+	{
+		if (low[i] < lanes.min_norm)
+			lanes.min_norm = low[i];
+		if (high[i] > lanes.max_norm)
+			lanes.max_norm = high[i];
+	}
+
+	moments.real += lanes.real;
+	moments.imag += lanes.imag;
+	moments.real_real += lanes.real_real;
+	moments.imag_imag += lanes.imag_imag;
+	moments.real_imag += lanes.real_imag;
+
+	if (lanes.min_norm < moments.min_norm)
+		moments.min_norm = lanes.min_norm;
+	if (lanes.max_norm > moments.max_norm)
+		moments.max_norm = lanes.max_norm;
+}
+
+#ifdef MUGED_SIMD_X86
+
+/**
+ * Complex multiplication of one value per register
+ */
+__attribute__((target("sse2")))
+static inline __m128d muged_multiply_sse2(__m128d w, __m128d x)
+{
+	__m128d w_real = _mm_unpacklo_pd(w, w);
+	__m128d w_imag = _mm_unpackhi_pd(w, w);
+	__m128d x_swap = _mm_shuffle_pd(x, x, 1);
+
+	//Negates real part of the product of imaginary parts
+	const __m128d sign = _mm_set_pd(0.0, -0.0);
+
+	return _mm_add_pd(_mm_mul_pd(w_real, x), _mm_xor_pd(_mm_mul_pd(w_imag, x_swap), sign));
+}
+
+/**
+ * Complex multiplication of two values per register, (wr*xr - wi*xi, wr*xi + wi*xr)
+ */
+__attribute__((target("avx2,fma")))
+static inline __m256d muged_multiply_avx2(__m256d w, __m256d x)
+{
+	__m256d w_real = _mm256_movedup_pd(w);
+	__m256d w_imag = _mm256_permute_pd(w, 0xF);
+	__m256d x_swap = _mm256_permute_pd(x, 0x5);
+
+	return _mm256_fmaddsub_pd(w_real, x, _mm256_mul_pd(w_imag, x_swap));
+}
+
+/**
+ * Complex multiplication of four values per register
+ */
+__attribute__((target("avx512f")))
+static inline __m512d muged_multiply_avx512(__m512d w, __m512d x)
+{
+	__m512d w_real = _mm512_movedup_pd(w);
+	__m512d w_imag = _mm512_permute_pd(w, 0xFF);
+	__m512d x_swap = _mm512_permute_pd(x, 0x55);
+
+	return _mm512_fmaddsub_pd(w_real, x, _mm512_mul_pd(w_imag, x_swap));
+}
+
+__attribute__((target("sse2")))
+static void muged_radix_2_stage_sse2(muged_scalar* data, size_t length, size_t half,
+                                     const muged_scalar* twiddles)
+{
+	double* samples = muged_as_doubles(data);
+	const double* w = muged_as_doubles(twiddles);
+
+	for (size_t block = 0; block < length; block += 2 * half)
+	{
+		double* even_part = samples + 2 * block;
+		double* odd_part = even_part + 2 * half;
+
+		for (size_t k = 0; k < half; k++)
+		{
+			__m128d even = _mm_loadu_pd(even_part + 2*k);
+			__m128d t = muged_multiply_sse2(_mm_loadu_pd(w + 2*k), _mm_loadu_pd(odd_part + 2*k));
+
+			_mm_storeu_pd(even_part + 2*k, _mm_add_pd(even, t));
+			_mm_storeu_pd(odd_part + 2*k, _mm_sub_pd(even, t));
+		}
+	}
+}
+
+__attribute__((target("avx2,fma")))
+static void muged_radix_2_stage_avx2(muged_scalar* data, size_t length, size_t half,
+                                     const muged_scalar* twiddles)
+{
+	double* samples = muged_as_doubles(data);
+	const double* w = muged_as_doubles(twiddles);
+
+	for (size_t block = 0; block < length; block += 2 * half)
+	{
+		double* even_part = samples + 2 * block;
+		double* odd_part = even_part + 2 * half;
+
+		for (size_t k = 0; k < half; k += 2)
+		{
+			__m256d even = _mm256_loadu_pd(even_part + 2*k);
+			__m256d t = muged_multiply_avx2(_mm256_loadu_pd(w + 2*k), _mm256_loadu_pd(odd_part + 2*k));
+
+			_mm256_storeu_pd(even_part + 2*k, _mm256_add_pd(even, t));
+			_mm256_storeu_pd(odd_part + 2*k, _mm256_sub_pd(even, t));
+		}
+	}
+}
+
+__attribute__((target("avx512f")))
+static void muged_radix_2_stage_avx512(muged_scalar* data, size_t length, size_t half,
+                                       const muged_scalar* twiddles)
+{
+	double* samples = muged_as_doubles(data);
+	const double* w = muged_as_doubles(twiddles);
+
+	for (size_t block = 0; block < length; block += 2 * half)
+	{
+		double* even_part = samples + 2 * block;
+		double* odd_part = even_part + 2 * half;
+
+		for (size_t k = 0; k < half; k += 4)
+		{
+			__m512d even = _mm512_loadu_pd(even_part + 2*k);
+			__m512d t = muged_multiply_avx512(_mm512_loadu_pd(w + 2*k), _mm512_loadu_pd(odd_part + 2*k));
+
+			_mm512_storeu_pd(even_part + 2*k, _mm512_add_pd(even, t));
+			_mm512_storeu_pd(odd_part + 2*k, _mm512_sub_pd(even, t));
+		}
+	}
+}
+
+/**
+ * Radix-4 pass of one SIMD width. Macro keeps the three variants identical,
+ * they differ only in register type and operations.
+ */
+#define MUGED_RADIX_4_PASS(VECTOR, WIDTH, LOAD, STORE, ADD, SUB, MUL, MULTIPLY, SWAP, SET_ROTATION)  \
+	double* samples = muged_as_doubles(data);                                                      \
+	const double* w1 = muged_as_doubles(twiddles);                                                 \
+	const double* w2 = w1 + 2 * quarter;                                                           \
+	const double* w3 = w2 + 2 * quarter;                                                           \
+	                                                                                               \
+	/* Multiplication by direction*i - lanes swapped, real part negated for forward transform */   \
+	const VECTOR rotation = SET_ROTATION;                                                          \
+	                                                                                               \
+	for (size_t block = 0; block < length; block += 4 * quarter)                                   \
+	{                                                                                              \
+		double* x0 = samples + 2 * block;                                                          \
+		double* x1 = x0 + 2 * quarter;                                                             \
+		double* x2 = x1 + 2 * quarter;                                                             \
+		double* x3 = x2 + 2 * quarter;                                                             \
+		                                                                                           \
+		for (size_t j = 0; j < 2 * quarter; j += WIDTH)                                            \
+		{                                                                                          \
+			VECTOR t = MULTIPLY(LOAD(w2 + j), LOAD(x1 + j));                                       \
+			VECTOR p = MULTIPLY(LOAD(w1 + j), LOAD(x2 + j));                                       \
+			VECTOR q = MULTIPLY(LOAD(w3 + j), LOAD(x3 + j));                                       \
+			VECTOR x = LOAD(x0 + j);                                                               \
+			                                                                                       \
+			VECTOR a0 = ADD(x, t);                                                                 \
+			VECTOR a1 = SUB(x, t);                                                                 \
+			VECTOR u = ADD(p, q);                                                                  \
+			VECTOR v = MUL(SWAP(SUB(p, q)), rotation);                                             \
+			                                                                                       \
+			STORE(x0 + j, ADD(a0, u));                                                             \
+			STORE(x2 + j, SUB(a0, u));                                                             \
+			STORE(x1 + j, ADD(a1, v));                                                             \
+			STORE(x3 + j, SUB(a1, v));                                                             \
+		}                                                                                          \
+	}
+
+#define MUGED_SWAP_SSE2(x) _mm_shuffle_pd(x, x, 1)
+#define MUGED_SWAP_AVX2(x) _mm256_permute_pd(x, 0x5)
+#define MUGED_SWAP_AVX512(x) _mm512_permute_pd(x, 0x55)
+
+__attribute__((target("sse2")))
+static void muged_radix_4_pass_sse2(muged_scalar* data, size_t length, size_t quarter,
+                                    const muged_scalar* twiddles, double direction)
+{
+	MUGED_RADIX_4_PASS(__m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_add_pd, _mm_sub_pd, _mm_mul_pd,
+	                   muged_multiply_sse2, MUGED_SWAP_SSE2, _mm_set_pd(direction, -direction))
+}
+
+__attribute__((target("avx2,fma")))
+static void muged_radix_4_pass_avx2(muged_scalar* data, size_t length, size_t quarter,
+                                    const muged_scalar* twiddles, double direction)
+{
+	MUGED_RADIX_4_PASS(__m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd,
+	                   muged_multiply_avx2, MUGED_SWAP_AVX2,
+	                   _mm256_set_pd(direction, -direction, direction, -direction))
+}
+
+__attribute__((target("avx512f")))
+static void muged_radix_4_pass_avx512(muged_scalar* data, size_t length, size_t quarter,
+                                      const muged_scalar* twiddles, double direction)
+{
+	MUGED_RADIX_4_PASS(__m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd,
+	                   muged_multiply_avx512, MUGED_SWAP_AVX512,
+	                   _mm512_set_pd(direction, -direction, direction, -direction,
+	                                 direction, -direction, direction, -direction))
+}
+
+__attribute__((target("sse2")))
+static void muged_deinterleave_sse2(const muged_scalar* input, size_t length, double* real, double* imag)
+{
+	if (imag == NULL)
+	{
+		muged_deinterleave_scalar(input, length, real, imag);
+		return;
+	}
+
+	const double* samples = muged_as_doubles(input);
+	size_t i = 0;
+
+	for (; i + 2 <= length; i += 2)
+	{
+		__m128d first = _mm_loadu_pd(samples + 2*i);
+		__m128d second = _mm_loadu_pd(samples + 2*i + 2);
+
+		_mm_storeu_pd(real + i, _mm_unpacklo_pd(first, second));
+		_mm_storeu_pd(imag + i, _mm_unpackhi_pd(first, second));
+	}
+
+	muged_deinterleave_scalar(input + i, length - i, real + i, imag + i);
+}
+
+__attribute__((target("sse2")))
+static void muged_interleave_sse2(const double* real, const double* imag, size_t length, muged_scalar* output)
+{
+	if (imag == NULL)
+	{
+		muged_interleave_scalar(real, imag, length, output);
+		return;
+	}
+
+	double* samples = muged_as_doubles(output);
+	size_t i = 0;
+
+	for (; i + 2 <= length; i += 2)
+	{
+		__m128d real_part = _mm_loadu_pd(real + i);
+		__m128d imag_part = _mm_loadu_pd(imag + i);
+
+		_mm_storeu_pd(samples + 2*i, _mm_unpacklo_pd(real_part, imag_part));
+		_mm_storeu_pd(samples + 2*i + 2, _mm_unpackhi_pd(real_part, imag_part));
+	}
+
+	muged_interleave_scalar(real + i, imag + i, length - i, output + i);
+}
+
+__attribute__((target("avx2,fma")))
+static void muged_deinterleave_avx2(const muged_scalar* input, size_t length, double* real, double* imag)
+{
+	if (imag == NULL)
+	{
+		muged_deinterleave_scalar(input, length, real, imag);
+		return;
+	}
+
+	const double* samples = muged_as_doubles(input);
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		//[r0 i0 r1 i1], [r2 i2 r3 i3] -> [r0 r2 r1 r3], [i0 i2 i1 i3] -> ordered lanes
+		__m256d first = _mm256_loadu_pd(samples + 2*i);
+		__m256d second = _mm256_loadu_pd(samples + 2*i + 4);
+
+		_mm256_storeu_pd(real + i, _mm256_permute4x64_pd(_mm256_unpacklo_pd(first, second), 0xD8));
+		_mm256_storeu_pd(imag + i, _mm256_permute4x64_pd(_mm256_unpackhi_pd(first, second), 0xD8));
+	}
+
+	muged_deinterleave_scalar(input + i, length - i, real + i, imag + i);
+}
+
+__attribute__((target("avx2,fma")))
+static void muged_interleave_avx2(const double* real, const double* imag, size_t length, muged_scalar* output)
+{
+	if (imag == NULL)
+	{
+		muged_interleave_scalar(real, imag, length, output);
+		return;
+	}
+
+	double* samples = muged_as_doubles(output);
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		__m256d real_part = _mm256_permute4x64_pd(_mm256_loadu_pd(real + i), 0xD8);
+		__m256d imag_part = _mm256_permute4x64_pd(_mm256_loadu_pd(imag + i), 0xD8);
+
+		_mm256_storeu_pd(samples + 2*i, _mm256_unpacklo_pd(real_part, imag_part));
+		_mm256_storeu_pd(samples + 2*i + 4, _mm256_unpackhi_pd(real_part, imag_part));
+	}
+
+	muged_interleave_scalar(real + i, imag + i, length - i, output + i);
+}
+
+__attribute__((target("sse2")))
+static double muged_sum_sse2(const double* values, size_t length)
+{
+	__m128d sum0 = _mm_setzero_pd();
+	__m128d sum1 = _mm_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		sum0 = _mm_add_pd(sum0, _mm_loadu_pd(values + i));
+		sum1 = _mm_add_pd(sum1, _mm_loadu_pd(values + i + 2));
+	}
+
+	double sums[2];
+	_mm_storeu_pd(sums, _mm_add_pd(sum0, sum1));
+
+	return sums[0] + sums[1] + muged_sum_scalar(values + i, length - i);
+}
+
+__attribute__((target("sse2")))
+static double muged_dot_sse2(const double* first, const double* second, size_t length)
+{
+	__m128d sum0 = _mm_setzero_pd();
+	__m128d sum1 = _mm_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 4 <= length; i += 4)
+	{
+		sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(first + i), _mm_loadu_pd(second + i)));
+		sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_loadu_pd(first + i + 2), _mm_loadu_pd(second + i + 2)));
+	}
+
+	double sums[2];
+	_mm_storeu_pd(sums, _mm_add_pd(sum0, sum1));
+
+	return sums[0] + sums[1] + muged_dot_scalar(first + i, second + i, length - i);
+}
+
+__attribute__((target("avx2,fma")))
+static double muged_sum_avx2(const double* values, size_t length)
+{
+	__m256d sum0 = _mm256_setzero_pd();
+	__m256d sum1 = _mm256_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 8 <= length; i += 8)
+	{
+		sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(values + i));
+		sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(values + i + 4));
+	}
+
+	double sums[4];
+	_mm256_storeu_pd(sums, _mm256_add_pd(sum0, sum1));
+
+	return (sums[0] + sums[1]) + (sums[2] + sums[3]) + muged_sum_scalar(values + i, length - i);
+}
+
+__attribute__((target("avx2,fma")))
+static double muged_dot_avx2(const double* first, const double* second, size_t length)
+{
+	__m256d sum0 = _mm256_setzero_pd();
+	__m256d sum1 = _mm256_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 8 <= length; i += 8)
+	{
+		sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(first + i), _mm256_loadu_pd(second + i), sum0);
+		sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(first + i + 4), _mm256_loadu_pd(second + i + 4), sum1);
+	}
+
+	double sums[4];
+	_mm256_storeu_pd(sums, _mm256_add_pd(sum0, sum1));
+
+	return (sums[0] + sums[1]) + (sums[2] + sums[3]) + muged_dot_scalar(first + i, second + i, length - i);
+}
+
+__attribute__((target("avx512f")))
+static double muged_sum_avx512(const double* values, size_t length)
+{
+	__m512d sum0 = _mm512_setzero_pd();
+	__m512d sum1 = _mm512_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16)
+	{
+		sum0 = _mm512_add_pd(sum0, _mm512_loadu_pd(values + i));
+		sum1 = _mm512_add_pd(sum1, _mm512_loadu_pd(values + i + 8));
+	}
+
+	double sums[8];
+	_mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+
+	return ((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7]))
+	       + muged_sum_scalar(values + i, length - i);
+}
+
+__attribute__((target("avx512f")))
+static double muged_dot_avx512(const double* first, const double* second, size_t length)
+{
+	__m512d sum0 = _mm512_setzero_pd();
+	__m512d sum1 = _mm512_setzero_pd();
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16)
+	{
+		sum0 = _mm512_fmadd_pd(_mm512_loadu_pd(first + i), _mm512_loadu_pd(second + i), sum0);
+		sum1 = _mm512_fmadd_pd(_mm512_loadu_pd(first + i + 8), _mm512_loadu_pd(second + i + 8), sum1);
+	}
+
+	double sums[8];
+	_mm512_storeu_pd(sums, _mm512_add_pd(sum0, sum1));
+
+	return ((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7]))
+	       + muged_dot_scalar(first + i, second + i, length - i);
+}
+
+/**
+ * Moments of one SIMD width, samples are loaded as they are stored: (a, b) pairs.
+ * Products with swapped lanes give ab, sum of lane with its neighbour gives |z|^2.
+ */
+#define MUGED_MOMENTS(VECTOR, WIDTH, LOAD, STORE, ZERO, SET1, ADD, MUL, MIN, MAX, SWAP)            \
+	const double* values = muged_as_doubles(samples);                                              \
+	VECTOR sum = ZERO(), square = ZERO(), cross = ZERO();                                          \
+	VECTOR low = SET1(HUGE_VAL), high = ZERO();                                                    \
+	size_t i = 0;                                                                                  \
+	                                                                                               \
+	for (; i + WIDTH/2 <= length; i += WIDTH/2)                                                    \
+	{                                                                                              \
+		VECTOR x = LOAD(values + 2 * i);                                                           \
+		VECTOR xx = MUL(x, x);                                                                     \
+		VECTOR norm = ADD(xx, SWAP(xx));                                                           \
+		                                                                                           \
+		sum = ADD(sum, x);                                                                         \
+		square = ADD(square, xx);                                                                  \
+		cross = ADD(cross, MUL(x, SWAP(x)));                                                       \
+		low = MIN(low, norm);                                                                      \
+		high = MAX(high, norm);                                                                    \
+	}                                                                                              \
+	                                                                                               \
+	double lanes[5][WIDTH];                                                                        \
+	STORE(lanes[0], sum);                                                                          \
+	STORE(lanes[1], square);                                                                       \
+	STORE(lanes[2], cross);                                                                        \
+	STORE(lanes[3], low);                                                                          \
+	STORE(lanes[4], high);                                                                         \
+	                                                                                               \
+	muged_moments_scalar(samples + i, length - i, moments);                                        \
+	muged_reduce_moments(lanes[0], lanes[1], lanes[2], lanes[3], lanes[4], WIDTH, moments);
+
+__attribute__((target("sse2")))
+static void muged_moments_sse2(const muged_scalar* samples, size_t length, muged_moments& moments)
+{
+	MUGED_MOMENTS(__m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_setzero_pd, _mm_set1_pd,
+	              _mm_add_pd, _mm_mul_pd, _mm_min_pd, _mm_max_pd, MUGED_SWAP_SSE2)
+}
+
+__attribute__((target("avx2,fma")))
+static void muged_moments_avx2(const muged_scalar* samples, size_t length, muged_moments& moments)
+{
+	MUGED_MOMENTS(__m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_setzero_pd, _mm256_set1_pd,
+	              _mm256_add_pd, _mm256_mul_pd, _mm256_min_pd, _mm256_max_pd, MUGED_SWAP_AVX2)
+}
+
+__attribute__((target("avx512f")))
+static void muged_moments_avx512(const muged_scalar* samples, size_t length, muged_moments& moments)
+{
+	MUGED_MOMENTS(__m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_setzero_pd, _mm512_set1_pd,
+	              _mm512_add_pd, _mm512_mul_pd, _mm512_min_pd, _mm512_max_pd, MUGED_SWAP_AVX512)
+}
+
+#endif /* MUGED_SIMD_X86 */
+
+MUGED_SIMDLevel muged_simd_supported()
+{
+#ifdef MUGED_SIMD_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f"))
+		return MUGED_SIMD_AVX512;
+
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		return MUGED_SIMD_AVX2;
+
+	if (__builtin_cpu_supports("sse2"))
+		return MUGED_SIMD_SSE2;
+#endif
+
+	return MUGED_SIMD_SCALAR;
+}
+
+/**
+ * Instruction set used by kernels, detected once
+ */
+static std::atomic<int>& muged_simd_state()
+{
+	static std::atomic<int> level(muged_simd_supported());
+	return level;
+}
+
+MUGED_SIMDLevel muged_simd_level()
+{
+	return (MUGED_SIMDLevel)muged_simd_state().load(std::memory_order_relaxed);
+}
+
+void muged_set_simd_level(MUGED_SIMDLevel level)
+{
+	MUGED_SIMDLevel supported = muged_simd_supported();
+	muged_simd_state().store(level < supported ? level : supported, std::memory_order_relaxed);
+}
+
+muged_radix_2_stage_kernel muged_radix_2_stage(size_t half)
+{
+#ifdef MUGED_SIMD_X86
+	//Wider kernels need at least one register of butterflies per block
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+		if (half >= 4)
+			return muged_radix_2_stage_avx512;
+		//fall through
+	case MUGED_SIMD_AVX2:
+		if (half >= 2)
+			return muged_radix_2_stage_avx2;
+		//fall through
+	case MUGED_SIMD_SSE2:
+		return muged_radix_2_stage_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_radix_2_stage_scalar;
+}
+
+muged_radix_4_pass_kernel muged_radix_4_pass(size_t quarter)
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+		if (quarter >= 4)
+			return muged_radix_4_pass_avx512;
+		//fall through
+	case MUGED_SIMD_AVX2:
+		if (quarter >= 2)
+			return muged_radix_4_pass_avx2;
+		//fall through
+	case MUGED_SIMD_SSE2:
+		return muged_radix_4_pass_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_radix_4_pass_scalar;
+}
+
+muged_deinterleave_kernel muged_deinterleave()
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+	case MUGED_SIMD_AVX2:
+		return muged_deinterleave_avx2;
+	case MUGED_SIMD_SSE2:
+		return muged_deinterleave_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_deinterleave_scalar;
+}
+
+muged_interleave_kernel muged_interleave()
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+	case MUGED_SIMD_AVX2:
+		return muged_interleave_avx2;
+	case MUGED_SIMD_SSE2:
+		return muged_interleave_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_interleave_scalar;
+}
+
+muged_sum_kernel muged_sum()
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+		return muged_sum_avx512;
+	case MUGED_SIMD_AVX2:
+		return muged_sum_avx2;
+	case MUGED_SIMD_SSE2:
+		return muged_sum_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_sum_scalar;
+}
+
+muged_dot_kernel muged_dot()
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+		return muged_dot_avx512;
+	case MUGED_SIMD_AVX2:
+		return muged_dot_avx2;
+	case MUGED_SIMD_SSE2:
+		return muged_dot_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_dot_scalar;
+}
+
+muged_moments_kernel muged_moments_sum()
+{
+#ifdef MUGED_SIMD_X86
+	switch (muged_simd_level())
+	{
+	case MUGED_SIMD_AVX512:
+		return muged_moments_avx512;
+	case MUGED_SIMD_AVX2:
+		return muged_moments_avx2;
+	case MUGED_SIMD_SSE2:
+		return muged_moments_sse2;
+	default:
+		break;
+	}
+#endif
+
+	return muged_moments_scalar;
+}
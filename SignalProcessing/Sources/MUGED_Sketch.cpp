@@ -0,0 +1,372 @@
+#include <algorithm>
+
+#include "MUGED_Sketch.h"
+#include "MUGED_VectorMath.h"
+
+/// Magnitudes calculated at once
+#define MUGED_SKETCH_BLOCK 256
+
+/// Buffer of quantile sketch holds compression times more values than centroids
+#define MUGED_SKETCH_BUFFER 5
+
+/**
+ * Calls add for magnitude of every sample, magnitudes of block are calculated
+ * by vector kernel
+ */
+template <class Add>
+static void muged_add_magnitudes(const muged_array& signal, const Add& add)
+{
+	double magnitudes[MUGED_SKETCH_BLOCK];
+
+	for (size_t begin = 0; begin < signal.length; begin += MUGED_SKETCH_BLOCK)
+	{
+		muged_array block;
+		block.array = signal.array + begin;
+		block.length = signal.length - begin < MUGED_SKETCH_BLOCK ? signal.length - begin : MUGED_SKETCH_BLOCK;
+
+		muged_real_array result;
+		result.array = magnitudes;
+		result.length = block.length;
+		muged_vector_abs_into(block, result);
+
+		add(magnitudes, block.length);
+	}
+}
+
+static bool muged_centroid_less(const muged_centroid& first, const muged_centroid& second)
+{
+	return first.mean < second.mean;
+}
+
+MUGED_QuantileSketch::MUGED_QuantileSketch(double compression)
+	: compression(compression)
+{
+	if (!(compression >= 1))
+		throw new MUGED_DSPException(ERR_SKETCH_COMPRESSION);
+
+	//At most compression + 2 centroids, buffer has room for them while they are merged
+	size_t centroids = (size_t)ceil(compression) + 2;
+	this->limit = MUGED_SKETCH_BUFFER * centroids;
+
+	this->centroids.reserve(centroids);
+	this->buffer.reserve(this->limit + centroids);
+
+	muged_reset();
+}
+
+void MUGED_QuantileSketch::muged_add(const muged_scalar& sample)
+{
+	double magnitude = sample.muged_abs();
+
+	//NaN has no place among sorted values
+	if (magnitude != magnitude)
+		return;
+
+	this->count++;
+	if (magnitude < this->minimum)
+		this->minimum = magnitude;
+	if (magnitude > this->maximum)
+		this->maximum = magnitude;
+
+	muged_add_centroid(magnitude, 1);
+}
+
+void MUGED_QuantileSketch::muged_add(const muged_array& signal)
+{
+	muged_add_magnitudes(signal, [this](const double* magnitudes, size_t length)
+	{
+		for (size_t i = 0; i < length; i++)
+		{
+			double magnitude = magnitudes[i];
+			if (magnitude != magnitude)
+				continue;
+
+			this->count++;
+			if (magnitude < this->minimum)
+				this->minimum = magnitude;
+			if (magnitude > this->maximum)
+				this->maximum = magnitude;
+
+			muged_add_centroid(magnitude, 1);
+		}
+	});
+}
+
+void MUGED_QuantileSketch::muged_merge(const MUGED_QuantileSketch& sketch)
+{
+	//Centroids of sketch merged with itself would change while they are read
+	if (&sketch == this)
+	{
+		MUGED_QuantileSketch copy(sketch);
+		muged_merge(copy);
+		return;
+	}
+
+	if (sketch.count == 0)
+		return;
+
+	for (size_t i = 0; i < sketch.centroids.size(); i++)
+		muged_add_centroid(sketch.centroids[i].mean, sketch.centroids[i].weight);
+	for (size_t i = 0; i < sketch.buffer.size(); i++)
+		muged_add_centroid(sketch.buffer[i].mean, sketch.buffer[i].weight);
+
+	this->count += sketch.count;
+	if (sketch.minimum < this->minimum)
+		this->minimum = sketch.minimum;
+	if (sketch.maximum > this->maximum)
+		this->maximum = sketch.maximum;
+}
+
+void MUGED_QuantileSketch::muged_add_centroid(double mean, double weight)
+{
+	muged_centroid centroid;
+	centroid.mean = mean;
+	centroid.weight = weight;
+	this->buffer.push_back(centroid);
+
+	if (this->buffer.size() >= this->limit)
+		muged_compress();
+}
+
+void MUGED_QuantileSketch::muged_compress()
+{
+	if (this->buffer.empty())
+		return;
+
+	//Centroids and new values sorted together
+	this->buffer.insert(this->buffer.end(), this->centroids.begin(), this->centroids.end());
+	std::sort(this->buffer.begin(), this->buffer.end(), muged_centroid_less);
+
+	double total = 0;
+	for (size_t i = 0; i < this->buffer.size(); i++)
+		total += this->buffer[i].weight;
+
+	//Centroid ends where scale function k(q) grows by 1 from its beginning
+	const double k_scale = this->compression / (2 * M_PI);
+	double before = 0;
+	double limit = (sin(asin(-1.0) + 1 / k_scale) + 1) / 2;
+
+	this->centroids.clear();
+	muged_centroid current = this->buffer[0];
+
+	for (size_t i = 1; i < this->buffer.size(); i++)
+	{
+		const muged_centroid& next = this->buffer[i];
+
+		if ((before + current.weight + next.weight) / total <= limit)
+		{
+			current.weight += next.weight;
+			current.mean += (next.mean - current.mean) * next.weight / current.weight;
+		}
+		else
+		{
+			this->centroids.push_back(current);
+			before += current.weight;
+
+			double k = asin(2 * before / total - 1) + 1 / k_scale;
+			limit = k < M_PI / 2 ? (sin(k) + 1) / 2 : 1;
+
+			current = next;
+		}
+	}
+
+	this->centroids.push_back(current);
+	this->buffer.clear();
+}
+
+double MUGED_QuantileSketch::muged_quantile(double q)
+{
+	muged_compress();
+
+	size_t centroids = this->centroids.size();
+	if (centroids == 0)
+		return 0;
+
+	if (q <= 0)
+		return this->minimum;
+	if (q >= 1)
+		return this->maximum;
+
+	//Every centroid stands at middle of its values, interpolated between neighbours
+	double index = q * this->count;
+
+	const muged_centroid& first = this->centroids[0];
+	if (index < first.weight / 2)
+		return this->minimum + index / (first.weight / 2) * (first.mean - this->minimum);
+
+	double cumulative = first.weight / 2;
+	for (size_t i = 0; i + 1 < centroids; i++)
+	{
+		const muged_centroid& current = this->centroids[i];
+		const muged_centroid& next = this->centroids[i + 1];
+		double step = (current.weight + next.weight) / 2;
+
+		if (index < cumulative + step)
+			return current.mean + (index - cumulative) / step * (next.mean - current.mean);
+
+		cumulative += step;
+	}
+
+	const muged_centroid& last = this->centroids[centroids - 1];
+	double result = last.mean + (index - cumulative) / (last.weight / 2) * (this->maximum - last.mean);
+
+	return result < this->maximum ? result : this->maximum;
+}
+
+void MUGED_QuantileSketch::muged_reset()
+{
+	this->centroids.clear();
+	this->buffer.clear();
+	this->count = 0;
+	this->minimum = HUGE_VAL;
+	this->maximum = -HUGE_VAL;
+}
+
+size_t MUGED_QuantileSketch::muged_count() const
+{
+	return this->count;
+}
+
+double MUGED_QuantileSketch::muged_minimum() const
+{
+	return this->count > 0 ? this->minimum : 0;
+}
+
+double MUGED_QuantileSketch::muged_maximum() const
+{
+	return this->count > 0 ? this->maximum : 0;
+}
+
+size_t MUGED_QuantileSketch::muged_centroids()
+{
+	muged_compress();
+	return this->centroids.size();
+}
+
+MUGED_Histogram::MUGED_Histogram(double minimum, double maximum, size_t bins)
+	: minimum(minimum), maximum(maximum), scale(0), underflow(0), overflow(0)
+{
+	if (bins == 0 || !(maximum > minimum))
+		throw new MUGED_DSPException(ERR_HISTOGRAM_RANGE);
+
+	this->scale = bins / (maximum - minimum);
+	this->counts.assign(bins, 0);
+}
+
+void MUGED_Histogram::muged_add(const muged_scalar& sample)
+{
+	double magnitude = sample.muged_abs();
+	muged_count_magnitudes(&magnitude, 1);
+}
+
+void MUGED_Histogram::muged_add(const muged_array& signal)
+{
+	muged_add_magnitudes(signal, [this](const double* magnitudes, size_t length)
+	{
+		muged_count_magnitudes(magnitudes, length);
+	});
+}
+
+void MUGED_Histogram::muged_count_magnitudes(const double* magnitudes, size_t length)
+{
+	size_t bins = this->counts.size();
+
+	for (size_t i = 0; i < length; i++)
+	{
+		double magnitude = magnitudes[i];
+
+		if (!(magnitude >= this->minimum))
+		{
+			this->underflow++;
+		}
+		else if (magnitude >= this->maximum)
+		{
+			this->overflow++;
+		}
+		else
+		{
+			//Rounding may put value just below maximum past the last bin
+			size_t bin = (size_t)((magnitude - this->minimum) * this->scale);
+			this->counts[bin < bins ? bin : bins - 1]++;
+		}
+	}
+}
+
+void MUGED_Histogram::muged_merge(const MUGED_Histogram& histogram)
+{
+	if (histogram.counts.size() != this->counts.size() || histogram.minimum != this->minimum
+	    || histogram.maximum != this->maximum)
+		throw new MUGED_DSPException(ERR_HISTOGRAM_LAYOUT);
+
+	for (size_t i = 0; i < this->counts.size(); i++)
+		this->counts[i] += histogram.counts[i];
+
+	this->underflow += histogram.underflow;
+	this->overflow += histogram.overflow;
+}
+
+void MUGED_Histogram::muged_reset()
+{
+	this->counts.assign(this->counts.size(), 0);
+	this->underflow = 0;
+	this->overflow = 0;
+}
+
+size_t MUGED_Histogram::muged_bins() const
+{
+	return this->counts.size();
+}
+
+double MUGED_Histogram::muged_edge(size_t bin) const
+{
+	return this->minimum + (this->maximum - this->minimum) * bin / this->counts.size();
+}
+
+size_t MUGED_Histogram::muged_count(size_t bin) const
+{
+	return this->counts[bin];
+}
+
+size_t MUGED_Histogram::muged_underflow() const
+{
+	return this->underflow;
+}
+
+size_t MUGED_Histogram::muged_overflow() const
+{
+	return this->overflow;
+}
+
+size_t MUGED_Histogram::muged_total() const
+{
+	size_t total = this->underflow + this->overflow;
+	for (size_t i = 0; i < this->counts.size(); i++)
+		total += this->counts[i];
+
+	return total;
+}
+
+double MUGED_Histogram::muged_quantile(double q) const
+{
+	size_t total = muged_total();
+	if (total == 0)
+		return this->minimum;
+
+	double target = q * total;
+	double cumulative = this->underflow;
+	if (target <= cumulative)
+		return this->minimum;
+
+	//Values are assumed to be spread evenly inside of bin
+	for (size_t i = 0; i < this->counts.size(); i++)
+	{
+		double count = this->counts[i];
+
+		if (count > 0 && target <= cumulative + count)
+			return muged_edge(i) + (target - cumulative) / count * (muged_edge(i + 1) - muged_edge(i));
+
+		cumulative += count;
+	}
+
+	return this->maximum;
+}
@@ -0,0 +1,856 @@
+#include <cfloat>
+
+#include "MUGED_VectorMath.h"
+#include "MUGED_SIMD.h"
+#include "MUGED_Parallel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MUGED_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Math functions below are written once for scalars (double, long long) and for
+ * vector types of every instruction set (GCC vector extensions), selects replace
+ * branches. Kernels of every instruction set are flattened, so the functions are
+ * inlined and compiled for the instruction set of the kernel using them.
+ */
+#define MUGED_VECTOR_INLINE static inline
+
+//Adding 1.5*2^52 rounds to integer, which is kept in low bits of the sum
+#define MUGED_ROUND_SHIFT 6755399441055744.0
+#define MUGED_ROUND_SHIFT_BITS 0x4338000000000000LL
+
+//π/2 split into parts with 33 significant bits (Cody-Waite), k*part is exact for |k| < 2^20
+#define MUGED_PIO2_1 1.57079632673412561417e+00
+#define MUGED_PIO2_2 6.07710050630396597660e-11
+#define MUGED_PIO2_3 2.02226624871116645580e-21
+
+//ln(2) split into parts, k*MUGED_LN2_HI is exact for |k| < 2^11
+#define MUGED_LN2_HI 6.93147180369123816490e-01
+#define MUGED_LN2_LO 1.90821492927058770002e-10
+
+//Difference between π/4 and its double value
+#define MUGED_PIO4_LO 6.123233995736765886130e-17
+
+//Scaling of values too large or too small to be squared
+#define MUGED_LOG_HUGE 3.2733906078961419e+150  // 2^500
+#define MUGED_LOG_TINY 3.0549363634996047e-151  // 2^-500
+#define MUGED_LOG_DOWN 2.4099198651028841e-181  // 2^-600
+#define MUGED_LOG_UP 4.1495155688809930e+180    // 2^600
+
+/**
+ * Vector types of given number of double lanes
+ */
+template <int W> struct muged_lanes;
+
+template <> struct muged_lanes<1>
+{
+	typedef double real;
+	typedef long long integer;
+};
+
+#ifdef MUGED_SIMD_X86
+template <> struct muged_lanes<2>
+{
+	typedef __m128d real;
+	typedef __m128i integer;
+};
+
+template <> struct muged_lanes<4>
+{
+	typedef __m256d real;
+	typedef __m256i integer;
+};
+
+template <> struct muged_lanes<8>
+{
+	typedef __m512d real;
+	typedef __m512i integer;
+};
+#endif
+
+/**
+ * Reinterprets bits of value (double <-> long long of every lane)
+ */
+template <class F, class T>
+MUGED_VECTOR_INLINE void muged_bit_cast(const F& from, T& to)
+{
+	memcpy(&to, &from, sizeof(to));
+}
+
+/**
+ * Checks if any lane of mask is set
+ */
+template <class I>
+MUGED_VECTOR_INLINE bool muged_any(const I& mask)
+{
+	long long lanes[sizeof(I) / sizeof(long long)];
+	memcpy(lanes, &mask, sizeof(lanes));
+
+	long long any = 0;
+	for (size_t i = 0; i < sizeof(lanes) / sizeof(long long); i++)
+		any |= lanes[i];
+
+	return any != 0;
+}
+
+/**
+ * Calculates sin(x) and cos(x), |x| <= MUGED_VECTOR_TRIG_LIMIT
+ */
+template <class V, class I>
+MUGED_VECTOR_INLINE void muged_sin_cos(const V& x, V& sine, V& cosine)
+{
+	//x = k*π/2 + r, |r| <= π/4
+	V shifted = x * M_2_PI + MUGED_ROUND_SHIFT;
+	V k = shifted - MUGED_ROUND_SHIFT;
+	V r = ((x - k * MUGED_PIO2_1) - k * MUGED_PIO2_2) - k * MUGED_PIO2_3;
+
+	I quadrant;
+	muged_bit_cast(shifted, quadrant);
+
+	//Minimax polynomials of sin(r) and cos(r) on [-π/4, π/4] (fdlibm)
+	V z = r * r;
+	V s = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03
+	                 + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06
+	                 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+	V c = 1.0 - (0.5 * z - z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03
+	                 + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07
+	                 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11))))));
+
+	//sin(x) = sin(r), cos(r), -sin(r), -cos(r) for k mod 4 = 0..3
+	I odd = (quadrant & 1) != 0;
+	V sine_r = odd ? c : s;
+	V cosine_r = odd ? s : c;
+
+	sine = (quadrant & 2) != 0 ? -sine_r : sine_r;
+	cosine = ((quadrant + 1) & 2) != 0 ? -cosine_r : cosine_r;
+}
+
+/**
+ * Calculates atan2(y, x) of finite values
+ */
+template <class V, class I>
+MUGED_VECTOR_INLINE void muged_atan2(const V& y, const V& x, V& angle)
+{
+	I x_bits, y_bits;
+	muged_bit_cast(x, x_bits);
+	muged_bit_cast(y, y_bits);
+
+	V ax = x < 0.0 ? -x : x;
+	V ay = y < 0.0 ? -y : y;
+
+	//atan(a), 0 <= a <= 1, atan2 of angles above π/4 is π/2 - atan(ax/ay)
+	I swap = ay > ax;
+	V numerator = swap ? ax : ay;
+	V denominator = swap ? ay : ax;
+	V a = numerator / denominator;
+	a = denominator == 0.0 ? V() : a;
+
+	//atan(a) = π/4 + atan((a-1)/(a+1)), rational approximation for |t| <= 0.66 (Cephes)
+	I high = a > 0.66;
+	V t = high ? (a - 1.0) / (a + 1.0) : a;
+	V z = t * t;
+	V p = (((-8.750608600031904122785e-01 * z - 1.615753718733365076637e+01) * z
+	       - 7.500855792314704667340e+01) * z - 1.228866684490136173410e+02) * z - 6.485021904942025371773e+01;
+	V q = ((((z + 2.485846490142306297962e+01) * z + 1.650270098316988542046e+02) * z
+	       + 4.328810604912902668951e+02) * z + 4.853903996359136964868e+02) * z + 1.945506571482613964425e+02;
+	V r = t + t * z * p / q;
+
+	r = high ? M_PI_4 + (r + MUGED_PIO4_LO) : r;
+	r = swap ? M_PI_2 + (2 * MUGED_PIO4_LO - r) : r;
+	r = x_bits < 0 ? M_PI + (4 * MUGED_PIO4_LO - r) : r;
+
+	angle = y_bits < 0 ? -r : r;
+}
+
+/**
+ * Calculates e^x
+ */
+template <class V, class I>
+MUGED_VECTOR_INLINE void muged_exp(const V& x, V& result)
+{
+	//Beyond the range result overflows or underflows anyway, inside it 2^k fits two factors
+	V t = x > 710.0 ? V() + 710.0 : x;
+	t = t < -746.0 ? V() - 746.0 : t;
+
+	//x = k*ln(2) + r, |r| <= ln(2)/2
+	V shifted = t * M_LOG2E + MUGED_ROUND_SHIFT;
+	V k = shifted - MUGED_ROUND_SHIFT;
+	V r = (t - k * MUGED_LN2_HI) - k * MUGED_LN2_LO;
+
+	//Taylor series of e^r up to r^13
+	V p = V() + 1.0 / 6227020800.0;
+	p = p * r + 1.0 / 479001600.0;
+	p = p * r + 1.0 / 39916800.0;
+	p = p * r + 1.0 / 3628800.0;
+	p = p * r + 1.0 / 362880.0;
+	p = p * r + 1.0 / 40320.0;
+	p = p * r + 1.0 / 5040.0;
+	p = p * r + 1.0 / 720.0;
+	p = p * r + 1.0 / 120.0;
+	p = p * r + 1.0 / 24.0;
+	p = p * r + 1.0 / 6.0;
+	p = p * r + 0.5;
+	p = p * r + 1.0;
+	p = p * r + 1.0;
+
+	//2^k = 2^k1 * 2^k2, each factor is a normal double
+	I k_bits;
+	muged_bit_cast(shifted, k_bits);
+	k_bits -= MUGED_ROUND_SHIFT_BITS;
+
+	I k1 = k_bits >> 1;
+	I k2 = k_bits - k1;
+
+	V scale1, scale2;
+	muged_bit_cast((k1 + 1023) << 52, scale1);
+	muged_bit_cast((k2 + 1023) << 52, scale2);
+
+	result = p * scale1 * scale2;
+}
+
+/**
+ * Calculates natural logarithm of x
+ */
+template <class V, class I>
+MUGED_VECTOR_INLINE void muged_log(const V& x, V& result)
+{
+	//Subnormal values are normalized by 2^54
+	I subnormal = x < DBL_MIN;
+	V normal = subnormal ? x * 18014398509481984.0 : x;
+
+	I bits;
+	muged_bit_cast(normal, bits);
+
+	I exponent = ((bits >> 52) & 0x7ff) - 1023;
+	exponent = subnormal ? exponent - 54 : exponent;
+
+	//x = m * 2^e, sqrt(2)/2 <= m < sqrt(2)
+	V m;
+	muged_bit_cast((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL, m);
+
+	I big = m > M_SQRT2;
+	m = big ? m * 0.5 : m;
+	exponent = big ? exponent + 1 : exponent;
+
+	V e;
+	muged_bit_cast(exponent + MUGED_ROUND_SHIFT_BITS, e);
+	e -= MUGED_ROUND_SHIFT;
+
+	//log(1+f) = 2*atanh(s), s = f/(2+f), polynomial of s^2 (fdlibm)
+	V f = m - 1.0;
+	V s = f / (2.0 + f);
+	V z = s * s;
+	V w = z * z;
+	V even = w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+	V odd = z * (6.666666666666735130e-01 + w * (2.857142874366239149e-01
+	                 + w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+	V half_square = 0.5 * f * f;
+
+	result = e * MUGED_LN2_HI - ((half_square - (s * (half_square + even + odd) + e * MUGED_LN2_LO)) - f);
+
+	result = x == HUGE_VAL ? x : result;
+	result = x == 0.0 ? V() - HUGE_VAL : result;
+	result = x >= 0.0 ? result : V() + NAN;
+}
+
+/**
+ * Element-wise operations, applied to real and imaginary parts of W samples
+ */
+struct muged_add_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& first_real, const V& first_imag,
+	                                     const V& second_real, const V& second_imag,
+	                                     V& real, V& imag)
+	{
+		real = first_real + second_real;
+		imag = first_imag + second_imag;
+	}
+};
+
+struct muged_multiply_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& first_real, const V& first_imag,
+	                                     const V& second_real, const V& second_imag,
+	                                     V& real, V& imag)
+	{
+		real = first_real * second_real - first_imag * second_imag;
+		imag = first_real * second_imag + first_imag * second_real;
+	}
+};
+
+struct muged_multiply_conj_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& first_real, const V& first_imag,
+	                                     const V& second_real, const V& second_imag,
+	                                     V& real, V& imag)
+	{
+		real = first_real * second_real + first_imag * second_imag;
+		imag = first_imag * second_real - first_real * second_imag;
+	}
+};
+
+struct muged_scale_operation
+{
+	double real_factor;
+	double imag_factor;
+
+	template <class V, class I>
+	inline void muged_apply(const V& signal_real, const V& signal_imag, V& real, V& imag) const
+	{
+		real = signal_real * this->real_factor;
+		imag = signal_imag * this->imag_factor;
+	}
+};
+
+struct muged_exp_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& signal_real, const V& signal_imag, V& real, V& imag)
+	{
+		V magnitude, sine, cosine;
+		muged_exp<V, I>(signal_real, magnitude);
+		muged_sin_cos<V, I>(signal_imag, sine, cosine);
+
+		//Arguments out of range of reduction are calculated by libm
+		I outside = (signal_imag < 0.0 ? -signal_imag : signal_imag) > MUGED_VECTOR_TRIG_LIMIT;
+		if (muged_any(outside))
+		{
+			const size_t lanes = sizeof(V) / sizeof(double);
+			double angles[lanes], sines[lanes], cosines[lanes];
+
+			memcpy(angles, &signal_imag, sizeof(V));
+			for (size_t i = 0; i < lanes; i++)
+			{
+				sines[i] = sin(angles[i]);
+				cosines[i] = cos(angles[i]);
+			}
+
+			memcpy(&sine, sines, sizeof(V));
+			memcpy(&cosine, cosines, sizeof(V));
+		}
+
+		real = magnitude * cosine;
+		imag = magnitude * sine;
+	}
+};
+
+struct muged_log_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& signal_real, const V& signal_imag, V& real, V& imag)
+	{
+		V ax = signal_real < 0.0 ? -signal_real : signal_real;
+		V ay = signal_imag < 0.0 ? -signal_imag : signal_imag;
+		V a = ax > ay ? ax : ay;
+
+		//log|z| = log(|z|^2)/2, samples are scaled so that |z|^2 doesn't overflow or underflow
+		I huge = a > MUGED_LOG_HUGE;
+		I tiny = a < MUGED_LOG_TINY;
+		V scale = huge ? V() + MUGED_LOG_DOWN : (tiny ? V() + MUGED_LOG_UP : V() + 1.0);
+		V offset = huge ? V() + 600 * M_LN2 : (tiny ? V() - 600 * M_LN2 : V());
+
+		V scaled_real = signal_real * scale;
+		V scaled_imag = signal_imag * scale;
+
+		V log_square;
+		muged_log<V, I>(scaled_real * scaled_real + scaled_imag * scaled_imag, log_square);
+
+		real = 0.5 * log_square + offset;
+		muged_atan2<V, I>(signal_imag, signal_real, imag);
+	}
+};
+
+struct muged_abs2_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& real, const V& imag, V& result)
+	{
+		result = real * real + imag * imag;
+	}
+};
+
+struct muged_angle_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& real, const V& imag, V& result)
+	{
+		muged_atan2<V, I>(imag, real, result);
+	}
+};
+
+/**
+ * Square root of every lane and loads/stores of W complex samples
+ */
+MUGED_VECTOR_INLINE void muged_sqrt(const double& value, double& result)
+{
+	result = sqrt(value);
+}
+
+MUGED_VECTOR_INLINE void muged_load_complex(const double* data, double& real, double& imag)
+{
+	real = data[0];
+	imag = data[1];
+}
+
+MUGED_VECTOR_INLINE void muged_store_complex(double* data, const double& real, const double& imag)
+{
+	data[0] = real;
+	data[1] = imag;
+}
+
+#ifdef MUGED_SIMD_X86
+__attribute__((target("sse2")))
+MUGED_VECTOR_INLINE void muged_sqrt(const __m128d& value, __m128d& result)
+{
+	result = _mm_sqrt_pd(value);
+}
+
+__attribute__((target("sse2")))
+MUGED_VECTOR_INLINE void muged_load_complex(const double* data, __m128d& real, __m128d& imag)
+{
+	__m128d low = _mm_loadu_pd(data);
+	__m128d high = _mm_loadu_pd(data + 2);
+
+	real = _mm_unpacklo_pd(low, high);
+	imag = _mm_unpackhi_pd(low, high);
+}
+
+__attribute__((target("sse2")))
+MUGED_VECTOR_INLINE void muged_store_complex(double* data, const __m128d& real, const __m128d& imag)
+{
+	_mm_storeu_pd(data, _mm_unpacklo_pd(real, imag));
+	_mm_storeu_pd(data + 2, _mm_unpackhi_pd(real, imag));
+}
+
+__attribute__((target("avx2,fma")))
+MUGED_VECTOR_INLINE void muged_sqrt(const __m256d& value, __m256d& result)
+{
+	result = _mm256_sqrt_pd(value);
+}
+
+__attribute__((target("avx2,fma")))
+MUGED_VECTOR_INLINE void muged_load_complex(const double* data, __m256d& real, __m256d& imag)
+{
+	__m256d low = _mm256_loadu_pd(data);
+	__m256d high = _mm256_loadu_pd(data + 4);
+
+	//Unpack gives order 0 2 1 3 within 128-bit lanes
+	real = _mm256_permute4x64_pd(_mm256_unpacklo_pd(low, high), 0xd8);
+	imag = _mm256_permute4x64_pd(_mm256_unpackhi_pd(low, high), 0xd8);
+}
+
+__attribute__((target("avx2,fma")))
+MUGED_VECTOR_INLINE void muged_store_complex(double* data, const __m256d& real, const __m256d& imag)
+{
+	__m256d low = _mm256_unpacklo_pd(real, imag);
+	__m256d high = _mm256_unpackhi_pd(real, imag);
+
+	_mm256_storeu_pd(data, _mm256_permute2f128_pd(low, high, 0x20));
+	_mm256_storeu_pd(data + 4, _mm256_permute2f128_pd(low, high, 0x31));
+}
+
+__attribute__((target("avx512f")))
+MUGED_VECTOR_INLINE void muged_sqrt(const __m512d& value, __m512d& result)
+{
+	result = _mm512_sqrt_pd(value);
+}
+
+__attribute__((target("avx512f")))
+MUGED_VECTOR_INLINE void muged_load_complex(const double* data, __m512d& real, __m512d& imag)
+{
+	__m512d low = _mm512_loadu_pd(data);
+	__m512d high = _mm512_loadu_pd(data + 8);
+
+	real = _mm512_permutex2var_pd(low, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), high);
+	imag = _mm512_permutex2var_pd(low, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), high);
+}
+
+__attribute__((target("avx512f")))
+MUGED_VECTOR_INLINE void muged_store_complex(double* data, const __m512d& real, const __m512d& imag)
+{
+	_mm512_storeu_pd(data, _mm512_permutex2var_pd(real, _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0), imag));
+	_mm512_storeu_pd(data + 8, _mm512_permutex2var_pd(real, _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4), imag));
+}
+#endif
+
+struct muged_abs_operation
+{
+	template <class V, class I>
+	MUGED_VECTOR_INLINE void muged_apply(const V& real, const V& imag, V& result)
+	{
+		muged_sqrt(real * real + imag * imag, result);
+	}
+};
+
+/**
+ * Loops over samples, W samples at once and the rest one by one
+ */
+template <int W, class Operation>
+MUGED_VECTOR_INLINE void muged_binary_loop(const Operation& operation, const double* first, const double* second,
+                                           size_t length, double* output)
+{
+	typedef typename muged_lanes<W>::real V;
+	typedef typename muged_lanes<W>::integer I;
+
+	size_t i = 0;
+	for (; i + W <= length; i += W)
+	{
+		V first_real, first_imag, second_real, second_imag, real, imag;
+		muged_load_complex(first + 2*i, first_real, first_imag);
+		muged_load_complex(second + 2*i, second_real, second_imag);
+
+		operation.template muged_apply<V, I>(first_real, first_imag, second_real, second_imag, real, imag);
+		muged_store_complex(output + 2*i, real, imag);
+	}
+
+	for (; i < length; i++)
+	{
+		double real, imag;
+		operation.template muged_apply<double, long long>(first[2*i], first[2*i+1], second[2*i], second[2*i+1],
+		                                                  real, imag);
+		muged_store_complex(output + 2*i, real, imag);
+	}
+}
+
+template <int W, class Operation>
+MUGED_VECTOR_INLINE void muged_unary_loop(const Operation& operation, const double* input,
+                                          size_t length, double* output)
+{
+	typedef typename muged_lanes<W>::real V;
+	typedef typename muged_lanes<W>::integer I;
+
+	size_t i = 0;
+	for (; i + W <= length; i += W)
+	{
+		V signal_real, signal_imag, real, imag;
+		muged_load_complex(input + 2*i, signal_real, signal_imag);
+
+		operation.template muged_apply<V, I>(signal_real, signal_imag, real, imag);
+		muged_store_complex(output + 2*i, real, imag);
+	}
+
+	for (; i < length; i++)
+	{
+		double real, imag;
+		operation.template muged_apply<double, long long>(input[2*i], input[2*i+1], real, imag);
+		muged_store_complex(output + 2*i, real, imag);
+	}
+}
+
+template <int W, class Operation>
+MUGED_VECTOR_INLINE void muged_real_loop(const Operation& operation, const double* input,
+                                         size_t length, double* output)
+{
+	typedef typename muged_lanes<W>::real V;
+	typedef typename muged_lanes<W>::integer I;
+
+	size_t i = 0;
+	for (; i + W <= length; i += W)
+	{
+		V signal_real, signal_imag, result;
+		muged_load_complex(input + 2*i, signal_real, signal_imag);
+
+		operation.template muged_apply<V, I>(signal_real, signal_imag, result);
+		memcpy(output + i, &result, sizeof(V));
+	}
+
+	//Tail advances pointers, index 2*i would let compiler assume overflow when W is 1
+	const double* sample = input + 2*i;
+	for (double* result = output + i; result < output + length; result++, sample += 2)
+		operation.template muged_apply<double, long long>(sample[0], sample[1], *result);
+}
+
+/**
+ * Loops compiled for every instruction set
+ */
+#ifdef MUGED_SIMD_X86
+#define MUGED_VECTOR_LOOPS(SUFFIX, TARGET, W)                                                          \
+template <class Operation> __attribute__((target(TARGET), flatten))                                          \
+static void muged_binary_##SUFFIX(const Operation& operation, const double* first, const double* second, \
+                                  size_t length, double* output)                                       \
+{                                                                                                      \
+	muged_binary_loop<W>(operation, first, second, length, output);                                    \
+}                                                                                                      \
+                                                                                                       \
+template <class Operation> __attribute__((target(TARGET), flatten))                                          \
+static void muged_unary_##SUFFIX(const Operation& operation, const double* input,                      \
+                                 size_t length, double* output)                                        \
+{                                                                                                      \
+	muged_unary_loop<W>(operation, input, length, output);                                             \
+}                                                                                                      \
+                                                                                                       \
+template <class Operation> __attribute__((target(TARGET), flatten))                                          \
+static void muged_real_##SUFFIX(const Operation& operation, const double* input,                       \
+                                size_t length, double* output)                                         \
+{                                                                                                      \
+	muged_real_loop<W>(operation, input, length, output);                                              \
+}
+
+MUGED_VECTOR_LOOPS(sse2, "sse2", 2)
+MUGED_VECTOR_LOOPS(avx2, "avx2,fma", 4)
+MUGED_VECTOR_LOOPS(avx512, "avx512f", 8)
+#endif
+
+/**
+ * Runs operation on all samples with kernel of used instruction set,
+ * long arrays are split between threads
+ */
+template <class Operation>
+static void muged_binary(const Operation& operation, const muged_scalar* first, const muged_scalar* second,
+                         size_t length, muged_scalar* output)
+{
+	const double* first_values = muged_as_doubles(first);
+	const double* second_values = muged_as_doubles(second);
+	double* output_values = muged_as_doubles(output);
+
+	MUGED_SIMDLevel level = muged_simd_level();
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		const double* a = first_values + 2*begin;
+		const double* b = second_values + 2*begin;
+		double* c = output_values + 2*begin;
+
+		switch (level)
+		{
+#ifdef MUGED_SIMD_X86
+		case MUGED_SIMD_AVX512:
+			muged_binary_avx512(operation, a, b, end - begin, c);
+			break;
+		case MUGED_SIMD_AVX2:
+			muged_binary_avx2(operation, a, b, end - begin, c);
+			break;
+		case MUGED_SIMD_SSE2:
+			muged_binary_sse2(operation, a, b, end - begin, c);
+			break;
+#endif
+		default:
+			muged_binary_loop<1>(operation, a, b, end - begin, c);
+			break;
+		}
+	};
+
+	if (length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(length, body);
+	else
+		body(0, length);
+}
+
+template <class Operation>
+static void muged_unary(const Operation& operation, const muged_scalar* input, size_t length, muged_scalar* output)
+{
+	const double* input_values = muged_as_doubles(input);
+	double* output_values = muged_as_doubles(output);
+
+	MUGED_SIMDLevel level = muged_simd_level();
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		const double* a = input_values + 2*begin;
+		double* c = output_values + 2*begin;
+
+		switch (level)
+		{
+#ifdef MUGED_SIMD_X86
+		case MUGED_SIMD_AVX512:
+			muged_unary_avx512(operation, a, end - begin, c);
+			break;
+		case MUGED_SIMD_AVX2:
+			muged_unary_avx2(operation, a, end - begin, c);
+			break;
+		case MUGED_SIMD_SSE2:
+			muged_unary_sse2(operation, a, end - begin, c);
+			break;
+#endif
+		default:
+			muged_unary_loop<1>(operation, a, end - begin, c);
+			break;
+		}
+	};
+
+	if (length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(length, body);
+	else
+		body(0, length);
+}
+
+template <class Operation>
+static void muged_real(const Operation& operation, const muged_scalar* input, size_t length, double* output)
+{
+	const double* input_values = muged_as_doubles(input);
+
+	MUGED_SIMDLevel level = muged_simd_level();
+	muged_parallel_body body = [&](size_t begin, size_t end)
+	{
+		const double* a = input_values + 2*begin;
+		double* c = output + begin;
+
+		switch (level)
+		{
+#ifdef MUGED_SIMD_X86
+		case MUGED_SIMD_AVX512:
+			muged_real_avx512(operation, a, end - begin, c);
+			break;
+		case MUGED_SIMD_AVX2:
+			muged_real_avx2(operation, a, end - begin, c);
+			break;
+		case MUGED_SIMD_SSE2:
+			muged_real_sse2(operation, a, end - begin, c);
+			break;
+#endif
+		default:
+			muged_real_loop<1>(operation, a, end - begin, c);
+			break;
+		}
+	};
+
+	if (length >= MUGED_PARALLEL_LENGTH)
+		muged_parallel_for(length, body);
+	else
+		body(0, length);
+}
+
+double muged_fast_sin(double x)
+{
+	if (fabs(x) > MUGED_VECTOR_TRIG_LIMIT)
+		return sin(x);
+
+	double sine, cosine;
+	muged_sin_cos<double, long long>(x, sine, cosine);
+	return sine;
+}
+
+double muged_fast_cos(double x)
+{
+	if (fabs(x) > MUGED_VECTOR_TRIG_LIMIT)
+		return cos(x);
+
+	double sine, cosine;
+	muged_sin_cos<double, long long>(x, sine, cosine);
+	return cosine;
+}
+
+double muged_fast_atan2(double y, double x)
+{
+	double angle;
+	muged_atan2<double, long long>(y, x, angle);
+	return angle;
+}
+
+double muged_fast_exp(double x)
+{
+	double result;
+	muged_exp<double, long long>(x, result);
+	return result;
+}
+
+double muged_fast_log(double x)
+{
+	double result;
+	muged_log<double, long long>(x, result);
+	return result;
+}
+
+void muged_vector_add(muged_array& first, muged_array& second, muged_array& result)
+{
+	if (first.length != second.length)
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	result.length = first.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_binary(muged_add_operation(), first.array, second.array, result.length, result.array);
+}
+
+void muged_vector_multiply(muged_array& first, muged_array& second, muged_array& result)
+{
+	if (first.length != second.length)
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	result.length = first.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_binary(muged_multiply_operation(), first.array, second.array, result.length, result.array);
+}
+
+void muged_vector_multiply_conj(muged_array& first, muged_array& second, muged_array& result)
+{
+	if (first.length != second.length)
+		throw new MUGED_DSPException(ERR_ARRAY_MISMATCH);
+
+	result.length = first.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_binary(muged_multiply_conj_operation(), first.array, second.array, result.length, result.array);
+}
+
+void muged_vector_scale(muged_array& signal, double factor, muged_array& result)
+{
+	result.length = signal.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_scale_operation operation = { factor, factor };
+	muged_unary(operation, signal.array, result.length, result.array);
+}
+
+void muged_vector_conj(muged_array& signal, muged_array& result)
+{
+	result.length = signal.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_scale_operation operation = { 1.0, -1.0 };
+	muged_unary(operation, signal.array, result.length, result.array);
+}
+
+void muged_vector_abs(muged_array& signal, muged_real_array& result)
+{
+	result.length = signal.length;
+	result.array = new double[result.length];
+
+	muged_real(muged_abs_operation(), signal.array, result.length, result.array);
+}
+
+size_t muged_vector_abs_into(muged_array& signal, muged_real_array& result)
+{
+	if (result.length < signal.length)
+		throw new MUGED_DSPException(ERR_ARRAY_LENGTH);
+
+	muged_real(muged_abs_operation(), signal.array, signal.length, result.array);
+
+	return signal.length;
+}
+
+void muged_vector_abs2(muged_array& signal, muged_real_array& result)
+{
+	result.length = signal.length;
+	result.array = new double[result.length];
+
+	muged_real(muged_abs2_operation(), signal.array, result.length, result.array);
+}
+
+void muged_vector_angle(muged_array& signal, muged_real_array& result)
+{
+	result.length = signal.length;
+	result.array = new double[result.length];
+
+	muged_real(muged_angle_operation(), signal.array, result.length, result.array);
+}
+
+void muged_vector_exp(muged_array& signal, muged_array& result)
+{
+	result.length = signal.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_unary(muged_exp_operation(), signal.array, result.length, result.array);
+}
+
+void muged_vector_log(muged_array& signal, muged_array& result)
+{
+	result.length = signal.length;
+	result.array = new muged_scalar[result.length];
+
+	muged_unary(muged_log_operation(), signal.array, result.length, result.array);
+}
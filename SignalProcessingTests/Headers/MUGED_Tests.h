@@ -9,6 +9,7 @@
 #define _MUGED_TESTS_H_
 
 #include "MUGED_Definitions.h"
+#include "MUGED_Types.h"
 
 #include "cute.h"
 #include "ide_listener.h"
@@ -16,6 +17,68 @@
 
 void _complex_test_();
 void _dsp_test_();
+void _fft_test_();
+void _split_test_();
+void _expression_test_();
+void _vector_test_();
+void _array_test_();
+void _into_test_();
+void _arena_test_();
+void _sample_view_test_();
+void _statistics_test_();
+void _accumulator_test_();
+void _moving_statistics_test_();
+void _sketch_test_();
+
+/**
+ * Lengths of element-wise tests - odd one checks tails of vector loops,
+ * long one is split between threads
+ */
+const size_t _test_lengths_[] = { 37, MUGED_PARALLEL_LENGTH + 3 };
+
+/**
+ * Allocates and fills test signal. Variant 0 is a wide range of values,
+ * starting with zero real part and negative zero imaginary part (edge cases
+ * of angle), variant 1 has small integer imaginary parts.
+ */
+inline void _test_signal_(muged_array& signal, size_t length, int variant)
+{
+	signal.length = length;
+	signal.array = new muged_scalar[length];
+
+	for (size_t i = 0; i < length; i++)
+	{
+		if (variant == 0)
+			signal.array[i] = muged_scalar(3 * sin(0.37 * i) + (i % 3) - 1, 4 * cos(0.011 * i * i));
+		else
+			signal.array[i] = muged_scalar(cos(0.5 * i), (i % 7) - 3.0);
+	}
+
+	if (variant == 0 && length >= 2)
+	{
+		signal.array[0] = muged_scalar(0, 2);
+		signal.array[1] = muged_scalar(-1, -0.0);
+	}
+}
+
+/**
+ * @return bool - true if function threw MUGED_DSPException
+ */
+template <class Function>
+inline bool _test_throws_(const Function& function)
+{
+	try
+	{
+		function();
+	}
+	catch (MUGED_DSPException* e)
+	{
+		delete e;
+		return true;
+	}
+
+	return false;
+}
 
 const double real_fft_128_ref[] = {
 56,
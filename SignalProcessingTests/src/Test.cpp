@@ -5,6 +5,18 @@ void runSuite()
 	cute::suite s;
 	s.push_back(CUTE(_dsp_test_));
 	s.push_back(CUTE(_complex_test_));
+	s.push_back(CUTE(_fft_test_));
+	s.push_back(CUTE(_split_test_));
+	s.push_back(CUTE(_vector_test_));
+	s.push_back(CUTE(_expression_test_));
+	s.push_back(CUTE(_array_test_));
+	s.push_back(CUTE(_into_test_));
+	s.push_back(CUTE(_arena_test_));
+	s.push_back(CUTE(_sample_view_test_));
+	s.push_back(CUTE(_statistics_test_));
+	s.push_back(CUTE(_accumulator_test_));
+	s.push_back(CUTE(_moving_statistics_test_));
+	s.push_back(CUTE(_sketch_test_));
 
 	cute::ide_listener lis;
 	cute::makeRunner(lis)(s, "The Suite");
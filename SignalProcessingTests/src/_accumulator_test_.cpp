@@ -0,0 +1,102 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Compares statistics with tolerance relative to expected values
+ */
+static void _accumulator_compare_(const muged_statistics& expected, const muged_statistics& result, double precision)
+{
+	ASSERT_EQUAL(expected.length, result.length);
+
+	ASSERT_EQUAL_DELTA(expected.mean.muged_real(), result.mean.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(expected.mean.muged_imag(), result.mean.muged_imag(), precision);
+	ASSERT_EQUAL_DELTA(expected.mean_square.muged_real(), result.mean_square.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(expected.mean_square.muged_imag(), result.mean_square.muged_imag(), precision);
+	ASSERT_EQUAL_DELTA(expected.root_mean_square.muged_real(), result.root_mean_square.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(expected.standard_deviation.muged_real(), result.standard_deviation.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(expected.standard_deviation.muged_imag(), result.standard_deviation.muged_imag(), precision);
+	ASSERT_EQUAL_DELTA(expected.minimum, result.minimum, precision);
+	ASSERT_EQUAL_DELTA(expected.maximum, result.maximum, precision);
+}
+
+/**
+ * Accumulator test - samples added one by one, in blocks and merged from
+ * partial accumulators compared with statistics of whole signal
+ */
+void _accumulator_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+	const size_t length = 1000;
+
+	MUGED_Array signal(length, MUGED_UNINITIALIZED);
+	for (size_t i = 0; i < length; i++)
+		signal[i] = muged_scalar(sin(0.3 * i) + (i % 7) * 0.2, cos(0.011 * i * i) - 0.5);
+
+	muged_statistics expected = dsp.muged_signal_statistics(signal.muged_view());
+
+	//Empty accumulator
+	MUGED_Accumulator accumulator;
+	ASSERT_EQUAL(0u, accumulator.muged_count());
+	ASSERT_EQUAL_DELTA(0, accumulator.muged_snapshot().maximum, 1e-12);
+
+	//Sample by sample
+	for (size_t i = 0; i < length; i++)
+		accumulator.muged_add(signal[i]);
+	_accumulator_compare_(expected, accumulator.muged_snapshot(), 1e-12);
+
+	//Blocks of different lengths
+	MUGED_Accumulator blocks;
+	for (size_t begin = 0, size = 1; begin < length; begin += size, size = 2 * size + 1)
+	{
+		muged_array block;
+		block.array = signal.muged_data() + begin;
+		block.length = begin + size < length ? size : length - begin;
+		blocks.muged_add(block);
+	}
+	_accumulator_compare_(expected, blocks.muged_snapshot(), 1e-12);
+
+	//Partial accumulators, e.g. of threads
+	MUGED_Accumulator parts[3];
+	for (size_t i = 0; i < length; i++)
+		parts[i * 3 / length].muged_add(signal[i]);
+
+	MUGED_Accumulator merged;
+	merged.muged_merge(parts[0]);
+	merged.muged_merge(MUGED_Accumulator());
+	merged.muged_merge(parts[1]);
+	merged.muged_merge(parts[2]);
+	_accumulator_compare_(expected, merged.muged_snapshot(), 1e-12);
+	ASSERT_EQUAL(length, merged.muged_count());
+
+	ASSERT_EQUAL_DELTA(expected.mean.muged_real(), merged.muged_mean().muged_real(), 1e-12);
+	ASSERT_EQUAL_DELTA(expected.root_mean_square.muged_real(), merged.muged_root_mean_square().muged_real(), 1e-12);
+
+	//Large offset - variance is kept, although sum of squares would cancel it
+	MUGED_Accumulator offset;
+	for (size_t i = 0; i < length; i++)
+		offset.muged_add(muged_scalar(1e9 + (i % 2), 0));
+	muged_array empty;
+	empty.array = NULL;
+	empty.length = 0;
+	offset.muged_add(empty);
+	ASSERT_EQUAL_DELTA(0.5, offset.muged_standard_deviation().muged_real(), 1e-6);
+
+	MUGED_Accumulator offset_blocks;
+	for (size_t i = 0; i < length; i++)
+		signal[i] = muged_scalar(1e9 + (i % 2), 0);
+	offset_blocks.muged_add(signal.muged_view());
+	offset_blocks.muged_add(signal.muged_view());
+	ASSERT_EQUAL_DELTA(0.5, offset_blocks.muged_standard_deviation().muged_real(), 1e-6);
+
+	//Samples in foreign format
+	int16_t samples[] = { 3, 1, -4, 0, 1, 2, 0, 0, 7, -7 };
+	MUGED_Accumulator converted;
+	converted.muged_add(MUGED_SampleView(samples, 5, 0.5));
+	_accumulator_compare_(dsp.muged_signal_statistics(MUGED_SampleView(samples, 5, 0.5)),
+	                      converted.muged_snapshot(), 1e-12);
+
+	accumulator.muged_reset();
+	ASSERT_EQUAL(0u, accumulator.muged_count());
+}
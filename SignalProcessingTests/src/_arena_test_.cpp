@@ -0,0 +1,115 @@
+#include <stdint.h>
+#include <thread>
+
+#include "MUGED_Tests.h"
+#include "MUGED_Arena.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Scratch arena test - alignment, nested release, coalescing of blocks and
+ * steady state of MUGED_DSP calls without heap allocations
+ */
+void _arena_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_Arena arena(256);
+	ASSERT_EQUAL(256u, arena.muged_capacity());
+	ASSERT_EQUAL(1u, arena.muged_heap_allocations());
+
+	{
+		MUGED_ArenaScope outer(arena);
+
+		char* first = arena.muged_allocate<char>(3);
+		double* second = arena.muged_allocate<double>(5);
+		ASSERT_EQUAL(0u, (uintptr_t)first % MUGED_ALIGNMENT);
+		ASSERT_EQUAL(0u, (uintptr_t)second % MUGED_ALIGNMENT);
+		ASSERT_EQUAL(128u, arena.muged_in_use());
+
+		{
+			MUGED_ArenaScope inner(arena);
+
+			//Doesn't fit in first block
+			muged_scalar* large = arena.muged_allocate<muged_scalar>(100);
+			ASSERT_EQUAL(0u, (uintptr_t)large % MUGED_ALIGNMENT);
+			large[99] = muged_scalar(1, 2);
+			ASSERT_EQUAL(2u, arena.muged_heap_allocations());
+		}
+
+		//Memory after mark is reused
+		ASSERT_EQUAL(128u, arena.muged_in_use());
+		ASSERT(arena.muged_allocate<char>(64) == first + 128);
+	}
+
+	//Released completely, blocks are replaced with one of peak size
+	ASSERT_EQUAL(0u, arena.muged_in_use());
+	ASSERT_EQUAL(128u + 1600u, arena.muged_peak());
+	ASSERT_EQUAL(arena.muged_peak(), arena.muged_capacity());
+	ASSERT_EQUAL(3u, arena.muged_heap_allocations());
+
+	//Steady state
+	arena.muged_reset_statistics();
+	for (int i = 0; i < 3; i++)
+	{
+		MUGED_ArenaScope scope(arena);
+		arena.muged_allocate<char>(128);
+		arena.muged_allocate<muged_scalar>(100);
+	}
+	ASSERT_EQUAL(0u, arena.muged_heap_allocations());
+
+	//Scope releases memory when exception is thrown
+	try
+	{
+		MUGED_ArenaScope scope(arena);
+		arena.muged_allocate<char>(10);
+		throw new MUGED_DSPException(ERR_NOT_IMPLEMENTED);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		delete e;
+	}
+	ASSERT_EQUAL(0u, arena.muged_in_use());
+
+	//Repeated transforms of MUGED_DSP reuse its scratch
+	MUGED_DSP dsp;
+	MUGED_Array signal(1000);
+	MUGED_Array spectrum(1000);
+	MUGED_Matrix image(48, 40);
+	for (size_t i = 0; i < signal.muged_length(); i++)
+		signal[i] = muged_scalar(sin(0.1 * i), i % 3);
+
+	for (int i = 0; i < 3; i++)
+	{
+		if (i == 1)
+			dsp.muged_scratch().muged_reset_statistics();
+
+		dsp.muged_1D_fft_into(signal.muged_view(), spectrum.muged_view());
+		dsp.muged_1D_ifft_in_place(spectrum.muged_view());
+		dsp.muged_2D_fft_in_place(image.muged_strided_view());
+		dsp.muged_root_mean_square(signal.muged_view());
+	}
+
+	ASSERT_EQUAL(0u, dsp.muged_scratch().muged_heap_allocations());
+	ASSERT_EQUAL(0u, dsp.muged_scratch().muged_in_use());
+	ASSERT(dsp.muged_scratch().muged_peak() >= 48 * 40 * sizeof(muged_scalar));
+
+	for (size_t i = 0; i < signal.muged_length(); i++)
+		ASSERT_EQUAL_DELTA(signal[i].muged_real(), spectrum[i].muged_real(), 1e-12);
+
+	//Object holds no scratch, copies and one object shared by threads use arenas of threads
+	MUGED_DSP copy(dsp);
+	MUGED_Array expected = copy.muged_1D_fft(signal.muged_view());
+	MUGED_Array first(1000);
+	MUGED_Array second(1000);
+	std::thread worker([&]() { dsp.muged_1D_fft_into(signal.muged_view(), first.muged_view()); });
+	dsp.muged_1D_fft_into(signal.muged_view(), second.muged_view());
+	worker.join();
+
+	for (size_t i = 0; i < expected.muged_length(); i++)
+	{
+		ASSERT_EQUAL(expected[i].muged_real(), first[i].muged_real());
+		ASSERT_EQUAL(expected[i].muged_imag(), second[i].muged_imag());
+	}
+
+	ASSERTM("Test shouldn't fails", true);
+}
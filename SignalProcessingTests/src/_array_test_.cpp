@@ -0,0 +1,270 @@
+#include <stdint.h>
+
+#include "MUGED_Tests.h"
+#include "MUGED_Array.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Compares owning result with plain one
+ */
+static void _array_compare_(const muged_array& expected, const muged_array& result)
+{
+	ASSERT_EQUAL(expected.length, result.length);
+
+	for (size_t i = 0; i < expected.length; i++)
+	{
+		ASSERT_EQUAL(expected.array[i].muged_real(), result.array[i].muged_real());
+		ASSERT_EQUAL(expected.array[i].muged_imag(), result.array[i].muged_imag());
+	}
+}
+
+/**
+ * Row, column and tile views of strided matrix and adapter of plain matrix
+ */
+static void _array_view_test_()
+{
+	MUGED_DSP dsp;
+
+	MUGED_Matrix image(9, 13, MUGED_UNINITIALIZED);
+	ASSERT(image.muged_stride() >= image.muged_cols());
+
+	MUGED_MatrixView view = image.muged_strided_view();
+	for (size_t r = 0; r < view.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < view.muged_cols(); c++)
+			view[r][c] = muged_scalar(sin(0.2 * r + 0.31 * c), (double)(r * c % 7));
+	}
+
+	//Views share samples with matrix
+	muged_array row = view.muged_row(4);
+	ASSERT(row.array == image[4]);
+	ASSERT_EQUAL(image.muged_cols(), row.length);
+
+	MUGED_StridedView column = view.muged_column(5);
+	ASSERT_EQUAL(image.muged_rows(), column.muged_length());
+	for (size_t r = 0; r < column.muged_length(); r++)
+		ASSERT(&column[r] == &image[r][5]);
+
+	MUGED_MatrixView tile = view.muged_tile(2, 3, 5, 8);
+	ASSERT(!tile.muged_contiguous());
+	ASSERT(tile[1] == &image[3][3]);
+
+	//Transform of tile equals transform of its copy
+	MUGED_Matrix tile_copy(tile);
+	MUGED_Matrix tile_spectrum = dsp.muged_2D_fft(tile);
+	MUGED_Matrix copy_spectrum = dsp.muged_2D_fft(tile_copy.muged_view());
+	for (size_t r = 0; r < tile.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < tile.muged_cols(); c++)
+		{
+			ASSERT_EQUAL(copy_spectrum[r][c].muged_real(), tile_spectrum[r][c].muged_real());
+			ASSERT_EQUAL(copy_spectrum[r][c].muged_imag(), tile_spectrum[r][c].muged_imag());
+		}
+	}
+
+	MUGED_Matrix tile_inverse = dsp.muged_2D_ifft(tile_spectrum.muged_strided_view());
+	for (size_t r = 0; r < tile.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < tile.muged_cols(); c++)
+		{
+			ASSERT_EQUAL_DELTA(tile[r][c].muged_real(), tile_inverse[r][c].muged_real(), 1e-12);
+			ASSERT_EQUAL_DELTA(tile[r][c].muged_imag(), tile_inverse[r][c].muged_imag(), 1e-12);
+		}
+	}
+
+	bool thrown = false;
+	try
+	{
+		view.muged_tile(5, 0, 5, 1);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+
+	//Plain matrices with equally spaced rows are adapted without copy
+	muged_matrix plain;
+	dsp.muged_2D_fft(image.muged_view(), plain);
+	ASSERT(muged_strided(plain));
+
+	MUGED_MatrixView adapted(plain);
+	ASSERT(adapted.muged_contiguous());
+	ASSERT(adapted[8] == plain.matrix[8]);
+
+	delete [] plain.matrix[0];
+	delete [] plain.matrix;
+
+	//Rows in reverse order can't be adapted
+	muged_scalar block[3 * 4];
+	muged_scalar* rows[] = { block + 8, block + 4, block };
+	plain.matrix = rows;
+	plain.rows = 3;
+	plain.cols = 4;
+	ASSERT(!muged_strided(plain));
+
+	thrown = false;
+	try
+	{
+		MUGED_MatrixView wrong(plain);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+}
+
+/**
+ * Owning arrays test - aligned storage, initialization, moves and results
+ * of MUGED_DSP returned by value
+ */
+void _array_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	//Storage
+	MUGED_Array zeros(37);
+	ASSERT_EQUAL(37u, zeros.muged_length());
+	ASSERT_EQUAL(0u, (uintptr_t)zeros.muged_data() % MUGED_ALIGNMENT);
+	for (size_t i = 0; i < zeros.muged_length(); i++)
+	{
+		ASSERT_EQUAL(0, zeros[i].muged_real());
+		ASSERT_EQUAL(0, zeros[i].muged_imag());
+	}
+
+	MUGED_RealArray empty;
+	ASSERT_EQUAL(0u, empty.muged_length());
+	ASSERT(empty.muged_data() == NULL);
+
+	//Move construction leaves source empty, move assignment exchanges samples
+	muged_scalar* data = zeros.muged_data();
+	MUGED_Array moved(std::move(zeros));
+	ASSERT(moved.muged_data() == data);
+	ASSERT(zeros.muged_data() == NULL);
+	ASSERT_EQUAL(0u, zeros.muged_length());
+
+	zeros = std::move(moved);
+	ASSERT(zeros.muged_data() == data);
+	ASSERT_EQUAL(37u, zeros.muged_length());
+
+	MUGED_Array other(5);
+	muged_scalar* other_data = other.muged_data();
+	other = std::move(zeros);
+	ASSERT(other.muged_data() == data);
+	ASSERT(zeros.muged_data() == other_data);
+	ASSERT_EQUAL(5u, zeros.muged_length());
+	zeros = std::move(other);
+
+	//Owning arrays are passed where plain ones are expected through their views
+	MUGED_Array signal(96, MUGED_UNINITIALIZED);
+	MUGED_RealArray real_signal(96, MUGED_UNINITIALIZED);
+	for (size_t i = 0; i < signal.muged_length(); i++)
+	{
+		signal[i] = muged_scalar(sin(0.3 * i) + (i % 5), cos(0.07 * i * i));
+		real_signal[i] = signal[i].muged_real();
+	}
+
+	MUGED_Array copy(signal.muged_view());
+	ASSERT(copy.muged_data() != signal.muged_data());
+	_array_compare_(signal, copy);
+
+	MUGED_DSP dsp;
+	muged_array plain;
+
+	MUGED_Array spectrum = dsp.muged_1D_fft(signal.muged_view());
+	dsp.muged_1D_fft(signal.muged_view(), plain);
+	_array_compare_(plain, spectrum);
+	delete [] plain.array;
+
+	MUGED_Array inverse = dsp.muged_1D_ifft(spectrum.muged_view());
+	dsp.muged_1D_ifft(spectrum.muged_view(), plain);
+	_array_compare_(plain, inverse);
+	delete [] plain.array;
+
+	MUGED_FFTPlan plan(128, MUGED_FFT_FORWARD);
+	MUGED_Array padded = dsp.muged_1D_fft(signal.muged_view(), plan);
+	dsp.muged_1D_fft(signal.muged_view(), plain, plan);
+	_array_compare_(plain, padded);
+	delete [] plain.array;
+
+	MUGED_Array half = dsp.muged_1D_rfft(real_signal.muged_view());
+	dsp.muged_1D_rfft(real_signal.muged_view(), plain);
+	_array_compare_(plain, half);
+	delete [] plain.array;
+
+	MUGED_RealArray restored = dsp.muged_1D_irfft(half.muged_view(), real_signal.muged_length());
+	ASSERT_EQUAL(real_signal.muged_length(), restored.muged_length());
+	for (size_t i = 0; i < restored.muged_length(); i++)
+		ASSERT_EQUAL_DELTA(real_signal[i], restored[i], 1e-12);
+
+	MUGED_Array spectra = dsp.muged_1D_fft_batch(signal.muged_view(), 16, 6, 1, 16);
+	dsp.muged_1D_fft_batch(signal.muged_view(), 16, 6, 1, 16, plain);
+	_array_compare_(plain, spectra);
+	delete [] plain.array;
+
+	MUGED_Array correlation = dsp.muged_1D_correlation(signal.muged_view(), copy.muged_view(), 2, 7);
+	dsp.muged_1D_correlation(signal.muged_view(), copy.muged_view(), 2, 7, plain);
+	_array_compare_(plain, correlation);
+	delete [] plain.array;
+
+	//Matrix rows are one aligned block
+	MUGED_Matrix image(6, 16, MUGED_UNINITIALIZED);
+	ASSERT_EQUAL(0u, (uintptr_t)image.muged_data() % MUGED_ALIGNMENT);
+	for (size_t r = 0; r < image.muged_rows(); r++)
+	{
+		ASSERT(image[r] == image.muged_data() + r * image.muged_stride());
+		ASSERT_EQUAL(0u, (uintptr_t)image[r] % MUGED_ALIGNMENT);
+		for (size_t c = 0; c < image.muged_cols(); c++)
+			image[r][c] = signal[r * 16 + c];
+	}
+
+	MUGED_Matrix image_spectrum = dsp.muged_2D_fft(image.muged_view());
+	muged_matrix plain_matrix;
+	dsp.muged_2D_fft(image.muged_view(), plain_matrix);
+	ASSERT_EQUAL(plain_matrix.rows, image_spectrum.muged_rows());
+	ASSERT_EQUAL(plain_matrix.cols, image_spectrum.muged_cols());
+	for (size_t r = 0; r < plain_matrix.rows; r++)
+	{
+		for (size_t c = 0; c < plain_matrix.cols; c++)
+		{
+			ASSERT_EQUAL(plain_matrix.matrix[r][c].muged_real(), image_spectrum[r][c].muged_real());
+			ASSERT_EQUAL(plain_matrix.matrix[r][c].muged_imag(), image_spectrum[r][c].muged_imag());
+		}
+	}
+	delete [] plain_matrix.matrix[0];
+	delete [] plain_matrix.matrix;
+
+	MUGED_Matrix image_copy = dsp.muged_2D_ifft(image_spectrum.muged_view());
+	for (size_t r = 0; r < image.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < image.muged_cols(); c++)
+		{
+			ASSERT_EQUAL_DELTA(image[r][c].muged_real(), image_copy[r][c].muged_real(), 1e-12);
+			ASSERT_EQUAL_DELTA(image[r][c].muged_imag(), image_copy[r][c].muged_imag(), 1e-12);
+		}
+	}
+
+	MUGED_Matrix moved_image(std::move(image_copy));
+	ASSERT(image_copy.muged_data() == NULL);
+	ASSERT_EQUAL(0u, image_copy.muged_rows());
+
+	//Too short spectrum, owning result is freed while exception propagates
+	bool thrown = false;
+	try
+	{
+		MUGED_RealArray wrong = dsp.muged_1D_irfft(half.muged_view(), 2 * real_signal.muged_length());
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+
+	_array_view_test_();
+
+	ASSERTM("Test shouldn't fails", true);
+}
@@ -106,5 +106,67 @@ void _complex_test_()
 	ASSERT_EQUAL_DELTA(0.33722, complex13.muged_real(), precision);
 	ASSERT_EQUAL_DELTA(-0.25914, complex13.muged_imag(), precision);
 
+	//Integer and non-integer powers
+	MUGED_Complex complex14 = complex3.muged_pow(-1);
+
+	ASSERT_EQUAL_DELTA(0.15385, complex14.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(-0.23077, complex14.muged_imag(), precision);
+
+	MUGED_Complex complex15 = complex3.muged_pow(0);
+
+	ASSERT_EQUAL_DELTA(1, complex15.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(0, complex15.muged_imag(), precision);
+
+	MUGED_Complex complex16 = complex3.muged_pow(0.5);
+
+	ASSERT_EQUAL_DELTA(1.67415, complex16.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(0.89598, complex16.muged_imag(), precision);
+
+	//Square roots with negative real or imaginary part
+	MUGED_Complex complex17 = MUGED_Complex(-4, 0).muged_sqrt();
+
+	ASSERT_EQUAL_DELTA(0, complex17.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(2, complex17.muged_imag(), precision);
+
+	MUGED_Complex complex18 = MUGED_Complex(3, -4).muged_sqrt();
+
+	ASSERT_EQUAL_DELTA(2, complex18.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(-1, complex18.muged_imag(), precision);
+
+	MUGED_Complex complex19 = MUGED_Complex(-3, -4).muged_sqrt();
+
+	ASSERT_EQUAL_DELTA(1, complex19.muged_real(), precision);
+	ASSERT_EQUAL_DELTA(-2, complex19.muged_imag(), precision);
+
+	//Arrays shared with std::complex<double> and double[2] without copying
+	MUGED_Complex values[2] = { complex1, complex2 };
+
+	std::complex<double>* std_values = muged_as_std_complex(values);
+	ASSERT_EQUAL_DELTA(1, std_values[1].real(), precision);
+	ASSERT_EQUAL_DELTA(2, std_values[1].imag(), precision);
+
+	std_values[0] *= std::complex<double>(0, 1);
+	ASSERT_EQUAL_DELTA(-1, values[0].muged_real(), precision);
+	ASSERT_EQUAL_DELTA(1, values[0].muged_imag(), precision);
+	ASSERT_EQUAL(values, muged_from_std_complex(std_values));
+
+	const double* doubles = muged_as_doubles(values);
+	ASSERT_EQUAL_DELTA(-1, doubles[0], precision);
+	ASSERT_EQUAL_DELTA(1, doubles[1], precision);
+	ASSERT_EQUAL_DELTA(1, doubles[2], precision);
+	ASSERT_EQUAL_DELTA(2, doubles[3], precision);
+
+	MUGED_Complex copies[2];
+	memcpy(copies, values, sizeof(values));
+	ASSERT_EQUAL_DELTA(2, copies[1].muged_imag(), precision);
+
+	//Conjugate, sum, difference and product of constants are constant expressions
+	constexpr MUGED_Complex zero;
+	constexpr MUGED_Complex product = zero * zero.muged_conj();
+	constexpr MUGED_Complex sum = zero + product;
+	constexpr MUGED_Complex difference = sum - zero;
+	ASSERT_EQUAL(0, difference.muged_real());
+	ASSERT_EQUAL(0, difference.muged_imag());
+
 	ASSERTM("Test shouldn't fails", true);
 }
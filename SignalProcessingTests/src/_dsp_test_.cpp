@@ -161,12 +161,12 @@ void _dsp_test_()
 
 
 	muged_array signal5;
-	signal5.length = 112;
+	signal5.length = 128;
 	signal5.array = new muged_scalar[signal5.length];
 
-	//Signal
+	//Signal of 112 samples zero padded to 128
 	for (unsigned int i = 0; i < signal5.length; i++)
-		signal5.array[i] = muged_scalar((i+1) % 2, 0);
+		signal5.array[i] = muged_scalar(i < 112 ? (i+1) % 2 : 0, 0);
 
 	muged_array ref_spectrum;
 	ref_spectrum.length = 128;
@@ -0,0 +1,173 @@
+#include <vector>
+#include <utility>
+
+#include "MUGED_Tests.h"
+#include "MUGED_Expression.h"
+
+/**
+ * Leaf expression recording index of every read sample and which leaf read it
+ */
+class _expression_probe_ : public MUGED_Expression<_expression_probe_>
+{
+public:
+	static const bool muged_constant = false;
+
+	_expression_probe_(const muged_array& array, int leaf, std::vector<std::pair<size_t, int> >& reads) noexcept
+		: array(array), leaf(leaf), reads(reads)
+	{
+	}
+
+	size_t muged_length() const noexcept
+	{
+		return this->array.length;
+	}
+
+	muged_scalar operator[](size_t i) const noexcept
+	{
+		this->reads.push_back(std::make_pair(i, this->leaf));
+		return this->array.array[i];
+	}
+
+private:
+	const muged_array& array;
+	int leaf;
+	std::vector<std::pair<size_t, int> >& reads;
+};
+
+/**
+ * Nested tree is evaluated in one pass without temporary arrays - all leaves
+ * read sample i before any of them reads sample i+1, every leaf reads every
+ * sample once
+ */
+static void _expression_single_pass_test_()
+{
+	muged_array x, y;
+	_test_signal_(x, 37, 0);
+	_test_signal_(y, 37, 1);
+
+	std::vector<std::pair<size_t, int> > reads;
+	reads.reserve(3 * x.length);
+
+	_expression_probe_ first(x, 0, reads);
+	_expression_probe_ second(y, 1, reads);
+	_expression_probe_ third(x, 2, reads);
+
+	muged_array result;
+	muged_evaluate(muged_exp(first * 2.0) + muged_conj(second) * muged_abs(third), result);
+
+	ASSERT_EQUAL(3 * x.length, reads.size());
+	for (size_t r = 0; r < reads.size(); r++)
+		ASSERT_EQUAL(r / 3, reads[r].first);
+
+	for (size_t i = 0; i < x.length; i++)
+	{
+		int leaves = 0;
+		for (size_t r = 3 * i; r < 3 * i + 3; r++)
+			leaves |= 1 << reads[r].second;
+		ASSERT_EQUAL(7, leaves);
+	}
+
+	delete [] x.array;
+	delete [] y.array;
+	delete [] result.array;
+}
+
+/**
+ * Expression templates test - fused expressions compared with sample by sample
+ * calculation, single pass evaluation, in-place assignment and length checks
+ */
+void _expression_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	const double precision = 1e-12;
+
+	_expression_single_pass_test_();
+
+	for (unsigned int l = 0; l < sizeof(_test_lengths_)/sizeof(_test_lengths_[0]); l++)
+	{
+		muged_array x, y;
+		_test_signal_(x, _test_lengths_[l], 0);
+		_test_signal_(y, _test_lengths_[l], 1);
+
+		muged_real_array window;
+		window.length = x.length;
+		window.array = new double[window.length];
+		for (unsigned int i = 0; i < window.length; i++)
+			window.array[i] = 0.5 - 0.5 * cos(0.1 * i);
+
+		double length = x.length;
+
+		muged_real_array power;
+		muged_evaluate(muged_abs(muged_conj(x) * y) / length, power);
+
+		muged_array mixed;
+		muged_evaluate(muged_exp(x * muged_scalar(0, 0.5)) - muged_log(y + muged_expression(window))
+		               + muged_abs2(x) / y * 2.0 - muged_angle(-x), mixed);
+
+		ASSERT_EQUAL(x.length, power.length);
+		ASSERT_EQUAL(x.length, mixed.length);
+
+		for (unsigned int i = 0; i < x.length; i++)
+		{
+			muged_scalar a = x.array[i];
+			muged_scalar b = y.array[i];
+
+			ASSERT_EQUAL_DELTA((a.muged_conj() * b).muged_abs() / length, power.array[i], precision);
+
+			muged_scalar rotated = a * muged_scalar(0, 0.5);
+			double magnitude = exp(rotated.muged_real());
+			muged_scalar shifted = b + muged_scalar(window.array[i], 0);
+			muged_scalar power_ratio = muged_scalar(a.muged_abs() * a.muged_abs(), 0) / b;
+
+			muged_scalar expected = muged_scalar(magnitude * cos(rotated.muged_imag()), magnitude * sin(rotated.muged_imag()))
+			                        - muged_scalar(log(shifted.muged_abs()), shifted.muged_angle())
+			                        + power_ratio * muged_scalar(2, 0)
+			                        - muged_scalar(muged_scalar(-a.muged_real(), -a.muged_imag()).muged_angle(), 0);
+
+			//Division by small samples of y gives large values, error is relative
+			double tolerance = precision * (1 + expected.muged_abs());
+			ASSERT_EQUAL_DELTA(expected.muged_real(), mixed.array[i].muged_real(), tolerance);
+			ASSERT_EQUAL_DELTA(expected.muged_imag(), mixed.array[i].muged_imag(), tolerance);
+		}
+
+		//In-place assignment, every sample uses only its own index
+		muged_array original;
+		muged_evaluate(muged_expression(x), original);
+		muged_assign(x, x * 2.0 + y);
+
+		for (unsigned int i = 0; i < x.length; i++)
+		{
+			muged_scalar expected = original.array[i] * muged_scalar(2, 0) + y.array[i];
+			ASSERT_EQUAL_DELTA(expected.muged_real(), x.array[i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(expected.muged_imag(), x.array[i].muged_imag(), precision);
+		}
+
+		delete [] x.array;
+		delete [] y.array;
+		delete [] original.array;
+		delete [] window.array;
+		delete [] power.array;
+		delete [] mixed.array;
+	}
+
+	//Arrays of different length
+	muged_array first, second;
+	_test_signal_(first, 4, 0);
+	_test_signal_(second, 5, 1);
+
+	ASSERT(_test_throws_([&]()
+	{
+		muged_array result;
+		muged_evaluate(muged_conj(first) * second, result);
+	}));
+	ASSERT(_test_throws_([&]()
+	{
+		muged_assign(second, first + muged_scalar(1, 1));
+	}));
+
+	delete [] first.array;
+	delete [] second.array;
+
+	ASSERTM("Test shouldn't fails", true);
+}
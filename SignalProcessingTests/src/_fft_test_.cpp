@@ -0,0 +1,454 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+#include "MUGED_Parallel.h"
+#include "MUGED_SIMD.h"
+
+/**
+ * Compares FFT of any length with DFT calculated from definition
+ * and checks that IFFT restores the signal
+ */
+static void _fft_length_test_(MUGED_DSP& dsp, size_t length)
+{
+	const double precision = 0.0001;
+	const double pi = 4 * atan(1);
+
+	muged_array signal;
+	signal.length = length;
+	signal.array = new muged_scalar[signal.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		signal.array[i] = muged_scalar(sin(0.1 * i) + (i % 3), cos(0.05 * i * i));
+
+	muged_array spectrum;
+	dsp.muged_1D_fft(signal, spectrum);
+
+	ASSERT_EQUAL(length, spectrum.length);
+	for (unsigned int k = 0; k < length; k++)
+	{
+		double real = 0;
+		double imag = 0;
+
+		for (unsigned int n = 0; n < length; n++)
+		{
+			double angle = -2 * pi * ((unsigned long long)n * k % length) / length;
+			real += signal.array[n].muged_real() * cos(angle) - signal.array[n].muged_imag() * sin(angle);
+			imag += signal.array[n].muged_real() * sin(angle) + signal.array[n].muged_imag() * cos(angle);
+		}
+
+		ASSERT_EQUAL_DELTA(real, spectrum.array[k].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(imag, spectrum.array[k].muged_imag(), precision);
+	}
+
+	muged_array signal_ifft;
+	dsp.muged_1D_ifft(spectrum, signal_ifft);
+
+	ASSERT_EQUAL(length, signal_ifft.length);
+	for (unsigned int i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL_DELTA(signal.array[i].muged_real(), signal_ifft.array[i].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(signal.array[i].muged_imag(), signal_ifft.array[i].muged_imag(), precision);
+	}
+
+	delete [] signal.array;
+	delete [] spectrum.array;
+	delete [] signal_ifft.array;
+}
+
+/**
+ * Compares FFT of real signal with complex FFT and checks that
+ * inverse transform restores the signal
+ */
+static void _rfft_length_test_(MUGED_DSP& dsp, size_t length)
+{
+	const double precision = 0.0001;
+
+	muged_real_array signal;
+	signal.length = length;
+	signal.array = new double[signal.length];
+
+	muged_array complex_signal;
+	complex_signal.length = length;
+	complex_signal.array = new muged_scalar[complex_signal.length];
+
+	for (unsigned int i = 0; i < length; i++)
+	{
+		signal.array[i] = sin(0.3 * i) + 0.5 * cos(0.01 * i * i) + (i % 4);
+		complex_signal.array[i] = muged_scalar(signal.array[i], 0);
+	}
+
+	muged_array spectrum;
+	dsp.muged_1D_rfft(signal, spectrum);
+
+	muged_array complex_spectrum;
+	dsp.muged_1D_fft(complex_signal, complex_spectrum);
+
+	ASSERT_EQUAL(length/2 + 1, spectrum.length);
+	for (unsigned int k = 0; k < spectrum.length; k++)
+	{
+		ASSERT_EQUAL_DELTA(complex_spectrum.array[k].muged_real(), spectrum.array[k].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(complex_spectrum.array[k].muged_imag(), spectrum.array[k].muged_imag(), precision);
+	}
+
+	muged_real_array signal_irfft;
+	dsp.muged_1D_irfft(spectrum, length, signal_irfft);
+
+	ASSERT_EQUAL(length, signal_irfft.length);
+	for (unsigned int i = 0; i < length; i++)
+		ASSERT_EQUAL_DELTA(signal.array[i], signal_irfft.array[i], precision);
+
+	delete [] signal.array;
+	delete [] complex_signal.array;
+	delete [] spectrum.array;
+	delete [] complex_spectrum.array;
+	delete [] signal_irfft.array;
+}
+
+/**
+ * Compares chosen bins of long (six-step) FFT with DFT calculated from
+ * definition and checks that IFFT restores the signal
+ */
+static void _fft_six_step_test_(MUGED_DSP& dsp, size_t length)
+{
+	const double precision = 0.0001;
+	const double pi = 4 * atan(1);
+
+	muged_array signal;
+	signal.length = length;
+	signal.array = new muged_scalar[signal.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		signal.array[i] = muged_scalar(sin(0.001 * i) + (i % 7), cos(1e-7 * i * i));
+
+	muged_array spectrum;
+	dsp.muged_1D_fft(signal, spectrum);
+
+	const size_t bins[] = { 0, 1, 17, 12345, length/3, length - 1 };
+	for (unsigned int b = 0; b < sizeof(bins)/sizeof(bins[0]); b++)
+	{
+		size_t k = bins[b];
+		double real = 0;
+		double imag = 0;
+
+		for (unsigned int n = 0; n < length; n++)
+		{
+			double angle = -2 * pi * ((unsigned long long)n * k % length) / length;
+			real += signal.array[n].muged_real() * cos(angle) - signal.array[n].muged_imag() * sin(angle);
+			imag += signal.array[n].muged_real() * sin(angle) + signal.array[n].muged_imag() * cos(angle);
+		}
+
+		ASSERT_EQUAL_DELTA(real, spectrum.array[k].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(imag, spectrum.array[k].muged_imag(), precision);
+	}
+
+	muged_array signal_ifft;
+	dsp.muged_1D_ifft(spectrum, signal_ifft);
+
+	for (unsigned int i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL_DELTA(signal.array[i].muged_real(), signal_ifft.array[i].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(signal.array[i].muged_imag(), signal_ifft.array[i].muged_imag(), precision);
+	}
+
+	delete [] signal.array;
+	delete [] spectrum.array;
+	delete [] signal_ifft.array;
+}
+
+/**
+ * Compares 2D FFT with 2D DFT calculated from definition (every bins-th bin)
+ * and checks that 2D IFFT restores the signal
+ */
+static void _fft_2D_test_(MUGED_DSP& dsp, size_t rows, size_t cols, size_t bins)
+{
+	const double precision = 0.0001;
+	const double pi = 4 * atan(1);
+
+	//Rows allocated separately
+	muged_matrix signal;
+	signal.rows = rows;
+	signal.cols = cols;
+	signal.matrix = new muged_scalar*[rows];
+
+	for (unsigned int r = 0; r < rows; r++)
+	{
+		signal.matrix[r] = new muged_scalar[cols];
+		for (unsigned int c = 0; c < cols; c++)
+			signal.matrix[r][c] = muged_scalar(sin(0.1 * r * c) + (r % 3), cos(0.05 * c) - (c % 2));
+	}
+
+	muged_matrix spectrum;
+	dsp.muged_2D_fft(signal, spectrum);
+
+	ASSERT_EQUAL(rows, spectrum.rows);
+	ASSERT_EQUAL(cols, spectrum.cols);
+	for (unsigned int bin = 0; bin < rows * cols; bin += bins)
+	{
+		size_t u = bin / cols;
+		size_t v = bin % cols;
+		double real = 0;
+		double imag = 0;
+
+		for (unsigned int r = 0; r < rows; r++)
+			for (unsigned int c = 0; c < cols; c++)
+			{
+				double angle = -2 * pi * ((double)(u * r % rows) / rows + (double)(v * c % cols) / cols);
+				real += signal.matrix[r][c].muged_real() * cos(angle) - signal.matrix[r][c].muged_imag() * sin(angle);
+				imag += signal.matrix[r][c].muged_real() * sin(angle) + signal.matrix[r][c].muged_imag() * cos(angle);
+			}
+
+		ASSERT_EQUAL_DELTA(real, spectrum.matrix[u][v].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(imag, spectrum.matrix[u][v].muged_imag(), precision);
+	}
+
+	muged_matrix signal_ifft;
+	dsp.muged_2D_ifft(spectrum, signal_ifft);
+
+	for (unsigned int r = 0; r < rows; r++)
+		for (unsigned int c = 0; c < cols; c++)
+		{
+			ASSERT_EQUAL_DELTA(signal.matrix[r][c].muged_real(), signal_ifft.matrix[r][c].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(signal.matrix[r][c].muged_imag(), signal_ifft.matrix[r][c].muged_imag(), precision);
+		}
+
+	for (unsigned int r = 0; r < rows; r++)
+		delete [] signal.matrix[r];
+	delete [] signal.matrix;
+
+	delete [] spectrum.matrix[0];
+	delete [] spectrum.matrix;
+	delete [] signal_ifft.matrix[0];
+	delete [] signal_ifft.matrix;
+}
+
+/**
+ * FFT test - testing FFT plans. Compares calculated values to
+ * the results obtained from GNU Octave
+ */
+void _fft_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	const double precision = 0.0001;
+
+	MUGED_DSP dsp;
+	MUGED_FFTPlan forward_plan(128, MUGED_FFT_FORWARD);
+	MUGED_FFTPlan inverse_plan(128, MUGED_FFT_INVERSE);
+
+	muged_array signal;
+	signal.length = 112;
+	signal.array = new muged_scalar[signal.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		signal.array[i] = muged_scalar((i+1) % 2, 0);
+
+	//Plan is reused for every transform
+	for (unsigned int repeat = 0; repeat < 2; repeat++)
+	{
+		muged_array spectrum;
+		dsp.muged_1D_fft(signal, spectrum, forward_plan);
+
+		ASSERT_EQUAL(128, spectrum.length);
+		for (unsigned int i = 0; i < spectrum.length; i++)
+		{
+			ASSERT_EQUAL_DELTA(real_fft_128_ref[i], spectrum.array[i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(imag_fft_128_ref[i], spectrum.array[i].muged_imag(), precision);
+		}
+
+		muged_array signal_ifft;
+		dsp.muged_1D_ifft(spectrum, signal_ifft, inverse_plan);
+
+		for (unsigned int i = 0; i < signal_ifft.length; i++)
+		{
+			double expected = i < signal.length ? signal.array[i].muged_real() : 0;
+			ASSERT_EQUAL_DELTA(expected, signal_ifft.array[i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(0, signal_ifft.array[i].muged_imag(), precision);
+		}
+
+		delete [] spectrum.array;
+		delete [] signal_ifft.array;
+	}
+
+	//In-place execution
+	muged_array buffer;
+	buffer.length = 128;
+	buffer.array = new muged_scalar[buffer.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		buffer.array[i] = signal.array[i];
+
+	forward_plan.muged_execute(buffer.array, signal.length, buffer.array);
+
+	for (unsigned int i = 0; i < buffer.length; i++)
+	{
+		ASSERT_EQUAL_DELTA(real_fft_128_ref[i], buffer.array[i].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(imag_fft_128_ref[i], buffer.array[i].muged_imag(), precision);
+	}
+
+	//Lengths which are not power of two - mixed-radix and Bluestein
+	const size_t lengths[] = { 1, 3, 12, 80, 112, 105, 1000, 1920, 31, 37, 97, 202 };
+	for (unsigned int i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+		_fft_length_test_(dsp, lengths[i]);
+
+	//Real signals
+	const size_t real_lengths[] = { 1, 2, 4, 7, 128, 112, 1000, 97, 194 };
+	for (unsigned int i = 0; i < sizeof(real_lengths)/sizeof(real_lengths[0]); i++)
+		_rfft_length_test_(dsp, real_lengths[i]);
+
+	//Batch of interleaved signals
+	muged_array batch;
+	batch.length = 3 * signal.length;
+	batch.array = new muged_scalar[batch.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		for (unsigned int k = 0; k < 3; k++)
+			batch.array[3*i + k] = signal.array[i] * muged_scalar(k + 1, k);
+
+	muged_array batch_spectra;
+	dsp.muged_1D_fft_batch(batch, signal.length, 3, 3, 1, batch_spectra);
+
+	ASSERT_EQUAL(3 * signal.length, batch_spectra.length);
+	for (unsigned int k = 0; k < 3; k++)
+	{
+		muged_array single;
+		single.length = signal.length;
+		single.array = new muged_scalar[single.length];
+		for (unsigned int i = 0; i < signal.length; i++)
+			single.array[i] = batch.array[3*i + k];
+
+		muged_array single_spectrum;
+		dsp.muged_1D_fft(single, single_spectrum);
+
+		for (unsigned int i = 0; i < single_spectrum.length; i++)
+		{
+			ASSERT_EQUAL_DELTA(single_spectrum.array[i].muged_real(), batch_spectra.array[k*signal.length + i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(single_spectrum.array[i].muged_imag(), batch_spectra.array[k*signal.length + i].muged_imag(), precision);
+		}
+
+		delete [] single.array;
+		delete [] single_spectrum.array;
+	}
+
+	//Contiguous batch of inverse transforms
+	muged_array batch_signals;
+	dsp.muged_1D_ifft_batch(batch_spectra, signal.length, 3, 1, signal.length, batch_signals);
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		for (unsigned int k = 0; k < 3; k++)
+		{
+			ASSERT_EQUAL_DELTA(batch.array[3*i + k].muged_real(), batch_signals.array[k*signal.length + i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(batch.array[3*i + k].muged_imag(), batch_signals.array[k*signal.length + i].muged_imag(), precision);
+		}
+
+	delete [] batch.array;
+	delete [] batch_spectra.array;
+	delete [] batch_signals.array;
+
+	//Every instruction set supported by CPU gives the same spectrum
+	MUGED_SIMDLevel supported = muged_simd_supported();
+	for (int level = MUGED_SIMD_SCALAR; level <= supported; level++)
+	{
+		muged_set_simd_level((MUGED_SIMDLevel)level);
+		ASSERT_EQUAL(level, muged_simd_level());
+
+		_fft_length_test_(dsp, 1024);
+
+		muged_array spectrum;
+		dsp.muged_1D_fft(signal, spectrum, forward_plan);
+		for (unsigned int i = 0; i < spectrum.length; i++)
+		{
+			ASSERT_EQUAL_DELTA(real_fft_128_ref[i], spectrum.array[i].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(imag_fft_128_ref[i], spectrum.array[i].muged_imag(), precision);
+		}
+		delete [] spectrum.array;
+	}
+	muged_set_simd_level(supported);
+
+	ASSERT_EQUAL(MUGED_FFT_MIXED_RADIX, MUGED_FFTPlan(1920, MUGED_FFT_FORWARD).muged_algorithm());
+	ASSERT_EQUAL(MUGED_FFT_BLUESTEIN, MUGED_FFTPlan(97, MUGED_FFT_FORWARD).muged_algorithm());
+	ASSERT_EQUAL(MUGED_FFT_SIX_STEP, MUGED_FFTPlan(MUGED_FFT_SIX_STEP_LENGTH, MUGED_FFT_FORWARD).muged_algorithm());
+
+	//Long transforms, single thread and sub-transforms split across threads
+	size_t threads = muged_thread_count();
+	muged_set_thread_count(1);
+	_fft_six_step_test_(dsp, MUGED_FFT_SIX_STEP_LENGTH);
+	muged_set_thread_count(3);
+	_fft_six_step_test_(dsp, MUGED_FFT_SIX_STEP_LENGTH);
+	_fft_six_step_test_(dsp, 1000 * 1050);
+
+	//Prime length above 2^19, Bluestein convolution is calculated by six-step plan
+	ASSERT_EQUAL(MUGED_FFT_BLUESTEIN, MUGED_FFTPlan(524309, MUGED_FFT_FORWARD).muged_algorithm());
+	_fft_six_step_test_(dsp, 524309);
+
+	//2D transforms, the largest one is calculated in parallel
+	_fft_2D_test_(dsp, 1, 1, 1);
+	_fft_2D_test_(dsp, 1, 16, 1);
+	_fft_2D_test_(dsp, 12, 16, 1);
+	_fft_2D_test_(dsp, 7, 5, 1);
+	_fft_2D_test_(dsp, 256, 320, 4099);
+
+	//Loop nested in body of parallel loop runs in thread of its body
+	size_t* visits = new size_t[3 * 100];
+	std::fill(visits, visits + 3 * 100, 0);
+	muged_parallel_for(3, [=](size_t begin, size_t end)
+	{
+		for (size_t outer = begin; outer < end; outer++)
+		{
+			muged_parallel_for(100, [=](size_t inner_begin, size_t inner_end)
+			{
+				for (size_t inner = inner_begin; inner < inner_end; inner++)
+					visits[outer * 100 + inner]++;
+			});
+		}
+	});
+	for (size_t i = 0; i < 3 * 100; i++)
+		ASSERT_EQUAL(1u, visits[i]);
+	delete [] visits;
+	muged_set_thread_count(threads);
+
+	//Plan cache
+	MUGED_FFTPlanCache cache(1);
+	bool owned;
+
+	const MUGED_FFTPlan* cached_plan = cache.muged_plan(64, MUGED_FFT_FORWARD, owned);
+	ASSERT(!owned);
+	ASSERT_EQUAL(cached_plan, cache.muged_plan(64, MUGED_FFT_FORWARD, owned));
+	ASSERT(!owned);
+	ASSERT_EQUAL(1, cache.muged_hits());
+	ASSERT_EQUAL(1, cache.muged_misses());
+
+	//Cache is full, caller owns the plan
+	const MUGED_FFTPlan* uncached_plan = cache.muged_plan(64, MUGED_FFT_INVERSE, owned);
+	ASSERT(owned);
+	ASSERT_EQUAL(MUGED_FFT_INVERSE, uncached_plan->muged_direction());
+	ASSERT_EQUAL(1, cache.muged_size());
+	delete uncached_plan;
+
+	//Cached plans have no own scratch, it doesn't count against the byte limit
+	MUGED_FFTPlanCache mixed_cache(1);
+	const MUGED_FFTPlan* mixed_plan = mixed_cache.muged_plan(60, MUGED_FFT_FORWARD, owned);
+	MUGED_FFTPlan own_plan(60, MUGED_FFT_FORWARD);
+	ASSERT_EQUAL(own_plan.muged_memory_size() - 60 * sizeof(muged_scalar), mixed_cache.muged_memory_size());
+	ASSERT_EQUAL(mixed_plan->muged_memory_size(), mixed_cache.muged_memory_size());
+
+	//Plan exceeding the byte limit is not stored
+	MUGED_FFTPlanCache tiny_cache(4, 1);
+	uncached_plan = tiny_cache.muged_plan(60, MUGED_FFT_FORWARD, owned);
+	ASSERT(owned);
+	ASSERT_EQUAL(0, tiny_cache.muged_size());
+	ASSERT_EQUAL(0, tiny_cache.muged_memory_size());
+	delete uncached_plan;
+
+	//Default transform reuses plans
+	size_t hits = MUGED_DSP::muged_plan_cache().muged_hits();
+	muged_array spectrum;
+	dsp.muged_1D_fft(signal, spectrum);
+	delete [] spectrum.array;
+	dsp.muged_1D_fft(signal, spectrum);
+	delete [] spectrum.array;
+	ASSERT(MUGED_DSP::muged_plan_cache().muged_hits() > hits);
+
+	delete [] signal.array;
+	delete [] buffer.array;
+
+	ASSERTM("Test shouldn't fails", true);
+}
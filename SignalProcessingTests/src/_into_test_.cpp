@@ -0,0 +1,219 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Compares result written into caller buffer with allocated one
+ */
+static void _into_compare_(const muged_array& expected, const muged_scalar* result, size_t length)
+{
+	ASSERT_EQUAL(expected.length, length);
+
+	for (size_t i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL(expected.array[i].muged_real(), result[i].muged_real());
+		ASSERT_EQUAL(expected.array[i].muged_imag(), result[i].muged_imag());
+	}
+}
+
+/**
+ * Checks that call throws MUGED_DSPException
+ */
+template <class F>
+static bool _into_throws_(F call)
+{
+	try
+	{
+		call();
+	}
+	catch (MUGED_DSPException* e)
+	{
+		delete e;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Caller buffers test - results of _into and _in_place methods compared with
+ * allocating methods, capacity checks
+ */
+void _into_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+	const size_t length = 60;
+
+	//Buffers are larger than results, only their beginning is written
+	MUGED_Array signal(length, MUGED_UNINITIALIZED);
+	MUGED_RealArray real_signal(length, MUGED_UNINITIALIZED);
+	MUGED_Array buffer(2 * length);
+	MUGED_RealArray real_buffer(2 * length);
+
+	for (size_t i = 0; i < length; i++)
+	{
+		signal[i] = muged_scalar(cos(0.4 * i) + (i % 4), sin(0.09 * i * i));
+		real_signal[i] = signal[i].muged_imag();
+	}
+
+	muged_array expected;
+
+	dsp.muged_1D_fft(signal.muged_view(), expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_fft_into(signal.muged_view(), buffer.muged_view()));
+	ASSERT_EQUAL(0, buffer[length].muged_real());
+	delete [] expected.array;
+
+	dsp.muged_1D_ifft(signal.muged_view(), expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_ifft_into(signal.muged_view(), buffer.muged_view()));
+	delete [] expected.array;
+
+	MUGED_FFTPlan forward(length, MUGED_FFT_FORWARD);
+	MUGED_FFTPlan inverse(length, MUGED_FFT_INVERSE);
+
+	dsp.muged_1D_fft(signal.muged_view(), expected, forward);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_fft_into(signal.muged_view(), buffer.muged_view(), forward));
+	delete [] expected.array;
+
+	dsp.muged_1D_ifft(signal.muged_view(), expected, inverse);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_ifft_into(signal.muged_view(), buffer.muged_view(), inverse));
+	delete [] expected.array;
+
+	dsp.muged_1D_rfft(real_signal.muged_view(), expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_rfft_into(real_signal.muged_view(), buffer.muged_view()));
+
+	ASSERT_EQUAL(length, dsp.muged_1D_irfft_into(expected, length, real_buffer.muged_view()));
+	for (size_t i = 0; i < length; i++)
+		ASSERT_EQUAL_DELTA(real_signal[i], real_buffer[i], 1e-12);
+	delete [] expected.array;
+
+	dsp.muged_1D_fft_batch(signal.muged_view(), 12, 4, 1, 15, expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_fft_batch_into(signal.muged_view(), 12, 4, 1, 15, buffer.muged_view()));
+	delete [] expected.array;
+
+	dsp.muged_1D_ifft_batch(signal.muged_view(), 15, 4, 4, 1, expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_ifft_batch_into(signal.muged_view(), 15, 4, 4, 1, buffer.muged_view()));
+	delete [] expected.array;
+
+	dsp.muged_1D_correlation(signal.muged_view(), signal.muged_view(), 3, 9, expected);
+	_into_compare_(expected, buffer.muged_data(), dsp.muged_1D_correlation_into(signal.muged_view(), signal.muged_view(), 3, 9, buffer.muged_view()));
+	delete [] expected.array;
+
+	//In place
+	MUGED_Array copy(signal.muged_view());
+	dsp.muged_1D_fft(signal.muged_view(), expected);
+	dsp.muged_1D_fft_in_place(copy.muged_view());
+	_into_compare_(expected, copy.muged_data(), copy.muged_length());
+	delete [] expected.array;
+
+	dsp.muged_1D_ifft_in_place(copy.muged_view(), inverse);
+	for (size_t i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL_DELTA(signal[i].muged_real(), copy[i].muged_real(), 1e-12);
+		ASSERT_EQUAL_DELTA(signal[i].muged_imag(), copy[i].muged_imag(), 1e-12);
+	}
+
+	//2D into tile of larger matrix and in place
+	MUGED_Matrix image(6, 10, MUGED_UNINITIALIZED);
+	for (size_t r = 0; r < image.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < image.muged_cols(); c++)
+			image[r][c] = signal[r * 10 + c];
+	}
+
+	MUGED_Matrix image_spectrum = dsp.muged_2D_fft(image.muged_view());
+	MUGED_Matrix canvas(10, 16);
+	MUGED_MatrixView tile = canvas.muged_strided_view().muged_tile(2, 3, 6, 10);
+	dsp.muged_2D_fft_into(image.muged_view(), tile);
+	dsp.muged_2D_fft_in_place(image.muged_strided_view());
+
+	for (size_t r = 0; r < image.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < image.muged_cols(); c++)
+		{
+			ASSERT_EQUAL(image_spectrum[r][c].muged_real(), tile[r][c].muged_real());
+			ASSERT_EQUAL(image_spectrum[r][c].muged_imag(), tile[r][c].muged_imag());
+			ASSERT_EQUAL(image_spectrum[r][c].muged_real(), image[r][c].muged_real());
+			ASSERT_EQUAL(image_spectrum[r][c].muged_imag(), image[r][c].muged_imag());
+		}
+	}
+	ASSERT_EQUAL(0, canvas[1][3].muged_real());
+	ASSERT_EQUAL(0, canvas[2][13].muged_real());
+
+	dsp.muged_2D_ifft_in_place(tile);
+	for (size_t r = 0; r < tile.muged_rows(); r++)
+	{
+		for (size_t c = 0; c < tile.muged_cols(); c++)
+			ASSERT_EQUAL_DELTA(signal[r * 10 + c].muged_real(), tile[r][c].muged_real(), 1e-12);
+	}
+
+	//Split-complex arrays
+	muged_split_array split, split_expected, split_buffer;
+	dsp.muged_to_split(signal.muged_view(), split);
+	muged_split_allocate(split_buffer, 2 * length);
+
+	dsp.muged_1D_fft(split, split_expected);
+	ASSERT_EQUAL(length, dsp.muged_1D_fft_into(split, split_buffer));
+	for (size_t i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL(split_expected.real[i], split_buffer.real[i]);
+		ASSERT_EQUAL(split_expected.imag[i], split_buffer.imag[i]);
+	}
+	muged_split_free(split_expected);
+
+	dsp.muged_1D_correlation(split, split, 2, 5, split_expected);
+	ASSERT_EQUAL(11u, dsp.muged_1D_correlation_into(split, split, 2, 5, split_buffer));
+	for (size_t i = 0; i < split_expected.length; i++)
+	{
+		ASSERT_EQUAL(split_expected.real[i], split_buffer.real[i]);
+		ASSERT_EQUAL(split_expected.imag[i], split_buffer.imag[i]);
+	}
+	muged_split_free(split_expected);
+
+	//Split transform in place
+	muged_split_array in_place = split_buffer;
+	in_place.length = length;
+	dsp.muged_1D_fft_into(split, in_place);
+	dsp.muged_1D_ifft_into(in_place, in_place);
+
+	ASSERT_EQUAL(length, dsp.muged_from_split_into(in_place, buffer.muged_view()));
+	for (size_t i = 0; i < length; i++)
+	{
+		ASSERT_EQUAL_DELTA(signal[i].muged_real(), buffer[i].muged_real(), 1e-12);
+		ASSERT_EQUAL_DELTA(signal[i].muged_imag(), buffer[i].muged_imag(), 1e-12);
+	}
+
+	//Too short buffers
+	muged_array short_buffer;
+	short_buffer.array = buffer.muged_data();
+	short_buffer.length = length - 1;
+
+	muged_array& source = signal.muged_view();
+	ASSERT(_into_throws_([&]() { dsp.muged_1D_fft_into(source, short_buffer); }));
+	ASSERT(_into_throws_([&]() { dsp.muged_1D_fft_into(source, short_buffer, forward); }));
+	ASSERT(_into_throws_([&]() { dsp.muged_1D_fft_in_place(short_buffer, forward); }));
+	ASSERT(_into_throws_([&]() { dsp.muged_1D_correlation_into(source, source, 0, length / 2, short_buffer); }));
+	ASSERT(_into_throws_([&]() { dsp.muged_2D_fft_into(image.muged_view(), canvas.muged_strided_view()); }));
+
+	muged_split_array real_split = split;
+	real_split.imag = NULL;
+	ASSERT(_into_throws_([&]() { dsp.muged_1D_fft_into(split, real_split); }));
+
+	//Batch of empty signals is rejected before its bounds are calculated
+	std::string error;
+	try
+	{
+		dsp.muged_1D_fft_batch_into(source, 0, 1, 1, 0, buffer.muged_view());
+	}
+	catch (MUGED_DSPException* e)
+	{
+		error = e->what();
+		delete e;
+	}
+	ASSERT_EQUAL(std::string(ERR_FFT_LENGTH), error);
+
+	muged_split_free(split);
+	muged_split_free(split_buffer);
+
+	ASSERTM("Test shouldn't fails", true);
+}
@@ -0,0 +1,142 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Compares two complex values with tolerance
+ */
+static void _moving_compare_(const muged_scalar& expected, const muged_scalar& result)
+{
+	ASSERT_EQUAL_DELTA(expected.muged_real(), result.muged_real(), 1e-9);
+	ASSERT_EQUAL_DELTA(expected.muged_imag(), result.muged_imag(), 1e-9);
+}
+
+/**
+ * Moving statistics test - statistics of sliding window compared with
+ * statistics of every window calculated from its samples
+ */
+void _moving_statistics_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+	const size_t length = 300;
+	const size_t window = 16;
+
+	MUGED_Array signal(length, MUGED_UNINITIALIZED);
+	for (size_t i = 0; i < length; i++)
+		signal[i] = muged_scalar(100 + sin(0.2 * i) + (i % 5), cos(0.017 * i * i) - 0.3);
+
+	//Sample by sample
+	MUGED_MovingStatistics moving(window);
+	ASSERT_EQUAL(window, moving.muged_window());
+
+	for (size_t i = 0; i < length; i++)
+	{
+		moving.muged_add(signal[i]);
+
+		//Window ending at sample i, shorter at the beginning
+		muged_array current;
+		current.length = i + 1 < window ? i + 1 : window;
+		current.array = signal.muged_data() + i + 1 - current.length;
+
+		muged_statistics expected = dsp.muged_signal_statistics(current);
+		ASSERT_EQUAL(current.length, moving.muged_count());
+		_moving_compare_(expected.mean, moving.muged_mean());
+		_moving_compare_(expected.mean_square, moving.muged_mean_square());
+		_moving_compare_(expected.root_mean_square, moving.muged_root_mean_square());
+		_moving_compare_(expected.standard_deviation, moving.muged_standard_deviation());
+	}
+
+	//Large offset, variance is calculated from deviations of window samples (two passes)
+	MUGED_MovingStatistics offset(window);
+	for (size_t i = 0; i < length; i++)
+	{
+		offset.muged_add(signal[i] + muged_scalar(1e6, -1e6));
+
+		size_t count = i + 1 < window ? i + 1 : window;
+		muged_scalar mean;
+		for (size_t j = i + 1 - count; j <= i; j++)
+			mean += signal[j];
+		mean = mean / count;
+
+		muged_scalar variance;
+		for (size_t j = i + 1 - count; j <= i; j++)
+		{
+			muged_scalar deviation = signal[j] - mean;
+			variance += deviation * deviation;
+		}
+		variance = variance / count;
+
+		_moving_compare_(variance.muged_sqrt(), offset.muged_standard_deviation());
+		_moving_compare_(mean + muged_scalar(1e6, -1e6), offset.muged_mean());
+	}
+
+	//Blocks give the same results as samples
+	MUGED_Array rms = dsp.muged_moving_root_mean_square(signal.muged_view(), window);
+	MUGED_Array std = dsp.muged_moving_standard_deviation(signal.muged_view(), window);
+	MUGED_Array mean = dsp.muged_moving_mean(signal.muged_view(), window);
+	MUGED_Array mean_square = dsp.muged_moving_mean_square(signal.muged_view(), window);
+
+	MUGED_MovingStatistics blocks(window);
+	MUGED_Array output(length, MUGED_UNINITIALIZED);
+
+	muged_array first, second;
+	first.array = signal.muged_data();
+	first.length = 37;
+	second.array = signal.muged_data() + first.length;
+	second.length = length - first.length;
+
+	muged_array first_output, second_output;
+	first_output.array = output.muged_data();
+	first_output.length = first.length;
+	second_output.array = output.muged_data() + first.length;
+	second_output.length = second.length;
+
+	ASSERT_EQUAL(first.length, blocks.muged_root_mean_square_into(first, first_output));
+	ASSERT_EQUAL(second.length, blocks.muged_root_mean_square_into(second, second_output));
+
+	moving.muged_reset();
+	ASSERT_EQUAL(0u, moving.muged_count());
+
+	for (size_t i = 0; i < length; i++)
+	{
+		moving.muged_add(signal[i]);
+
+		_moving_compare_(moving.muged_root_mean_square(), output[i]);
+		_moving_compare_(moving.muged_root_mean_square(), rms[i]);
+		_moving_compare_(moving.muged_standard_deviation(), std[i]);
+		_moving_compare_(moving.muged_mean(), mean[i]);
+		_moving_compare_(moving.muged_mean_square(), mean_square[i]);
+	}
+
+	//In place
+	MUGED_MovingStatistics in_place(window);
+	in_place.muged_mean_into(signal.muged_view(), signal.muged_view());
+	for (size_t i = 0; i < length; i++)
+		_moving_compare_(mean[i], signal[i]);
+
+	//Short output and empty window
+	bool thrown = false;
+	try
+	{
+		in_place.muged_mean_into(signal, first_output);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+
+	thrown = false;
+	try
+	{
+		MUGED_MovingStatistics empty(0);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+}
@@ -0,0 +1,104 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Compares two complex values with tolerance
+ */
+static void _sample_view_compare_(const muged_scalar& expected, const muged_scalar& result)
+{
+	ASSERT_EQUAL_DELTA(expected.muged_real(), result.muged_real(), 1e-9);
+	ASSERT_EQUAL_DELTA(expected.muged_imag(), result.muged_imag(), 1e-9);
+}
+
+/**
+ * Compares results of view with results of converted muged_array
+ */
+static void _sample_view_check_(MUGED_DSP& dsp, const MUGED_SampleView& view, const MUGED_SampleView& other)
+{
+	size_t length = view.muged_length();
+
+	//Reference - samples converted into muged_array
+	MUGED_Array samples(length, MUGED_UNINITIALIZED);
+	view.muged_convert(0, length, samples.muged_data());
+
+	MUGED_Array other_samples(other.muged_length(), MUGED_UNINITIALIZED);
+	other.muged_convert(0, other.muged_length(), other_samples.muged_data());
+
+	for (size_t i = 0; i < length; i++)
+		_sample_view_compare_(samples[i], view[i]);
+
+	_sample_view_compare_(dsp.muged_mean(samples.muged_view()), dsp.muged_mean(view));
+	_sample_view_compare_(dsp.muged_mean_square(samples.muged_view()), dsp.muged_mean_square(view));
+	_sample_view_compare_(dsp.muged_root_mean_square(samples.muged_view()), dsp.muged_root_mean_square(view));
+	_sample_view_compare_(dsp.muged_standard_deviation(samples.muged_view()), dsp.muged_standard_deviation(view));
+
+	MUGED_Array expected = dsp.muged_1D_fft(samples.muged_view());
+	MUGED_Array spectrum = dsp.muged_1D_fft(view);
+	ASSERT_EQUAL(expected.muged_length(), spectrum.muged_length());
+	for (size_t i = 0; i < length; i++)
+		_sample_view_compare_(expected[i], spectrum[i]);
+
+	MUGED_Array expected_correlation = dsp.muged_1D_correlation(samples.muged_view(), other_samples.muged_view(), 0, 5);
+	MUGED_Array correlation = dsp.muged_1D_correlation(view, other, 0, 5);
+	ASSERT_EQUAL(expected_correlation.muged_length(), correlation.muged_length());
+	for (size_t i = 0; i < correlation.muged_length(); i++)
+		_sample_view_compare_(expected_correlation[i], correlation[i]);
+}
+
+/**
+ * Sample view test - statistics, FFT and correlation of samples in foreign
+ * formats compared with converted samples
+ */
+void _sample_view_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+	const size_t length = 48;
+
+	MUGED_Array complex_samples(length, MUGED_UNINITIALIZED);
+	MUGED_RealArray real_samples(length, MUGED_UNINITIALIZED);
+	float float_samples[2 * length];
+	int16_t int16_samples[2 * length];
+
+	for (size_t i = 0; i < length; i++)
+	{
+		double re = cos(0.3 * i) + (i % 5) * 0.1;
+		double im = sin(0.07 * i * i);
+
+		complex_samples[i] = muged_scalar(re, im);
+		real_samples[i] = re;
+		float_samples[2 * i] = (float)re;
+		float_samples[2 * i + 1] = (float)im;
+		int16_samples[2 * i] = (int16_t)(re * 10000);
+		int16_samples[2 * i + 1] = (int16_t)(im * 10000);
+	}
+
+	MUGED_SampleView complex_view(complex_samples.muged_view());
+	MUGED_SampleView real_view(real_samples.muged_view());
+	MUGED_SampleView double_view(real_samples.muged_data(), length);
+	MUGED_SampleView float_view(float_samples, length);
+	MUGED_SampleView int16_view(int16_samples, length, 1e-4);
+
+	ASSERT_EQUAL(MUGED_SAMPLE_COMPLEX, complex_view.muged_format());
+	ASSERT_EQUAL(MUGED_SAMPLE_REAL, real_view.muged_format());
+	ASSERT_EQUAL(MUGED_SAMPLE_FLOAT_IQ, float_view.muged_format());
+	ASSERT_EQUAL(MUGED_SAMPLE_INT16_IQ, int16_view.muged_format());
+
+	//Scale is applied
+	ASSERT_EQUAL_DELTA(int16_samples[2] * 1e-4, int16_view[1].muged_real(), 1e-12);
+	ASSERT_EQUAL_DELTA(int16_samples[3] * 1e-4, int16_view[1].muged_imag(), 1e-12);
+
+	_sample_view_check_(dsp, complex_view, float_view);
+	_sample_view_check_(dsp, real_view, int16_view);
+	_sample_view_check_(dsp, double_view, complex_view);
+	_sample_view_check_(dsp, float_view, real_view);
+	_sample_view_check_(dsp, int16_view, int16_view);
+
+	//Real view of odd length
+	MUGED_SampleView odd_view(real_samples.muged_data(), length - 1);
+	_sample_view_check_(dsp, odd_view, float_view);
+
+	//Views don't leave scratch memory in use
+	ASSERT_EQUAL(0u, dsp.muged_scratch().muged_in_use());
+}
@@ -0,0 +1,129 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+
+/**
+ * Sketch test - quantiles and histogram of magnitudes of stream compared with
+ * exact values, merge of partial sketches, bounded memory
+ */
+void _sketch_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	//Magnitudes 0, 0.0001, ..., 9.9999 in scrambled order, quantile q is about 10q
+	const size_t length = 100000;
+	MUGED_Array signal(length, MUGED_UNINITIALIZED);
+
+	for (size_t i = 0; i < length; i++)
+	{
+		double magnitude = (i * 7919 % length) * 10.0 / length;
+		double angle = 0.37 * i;
+		signal[i] = muged_scalar(magnitude * cos(angle), magnitude * sin(angle));
+	}
+
+	const double quantiles[] = { 0.001, 0.25, 0.5, 0.9, 0.99, 0.999 };
+	const size_t count = sizeof(quantiles)/sizeof(quantiles[0]);
+
+	MUGED_QuantileSketch sketch;
+	sketch.muged_add(signal);
+
+	ASSERT_EQUAL(length, sketch.muged_count());
+	ASSERT_EQUAL_DELTA(0, sketch.muged_minimum(), 1e-12);
+	ASSERT_EQUAL_DELTA(9.9999, sketch.muged_maximum(), 1e-12);
+	ASSERT(sketch.muged_centroids() <= MUGED_SKETCH_COMPRESSION + 2);
+
+	//Error below 0.1% of range (0.05% measured)
+	for (size_t i = 0; i < count; i++)
+		ASSERT_EQUAL_DELTA(10 * quantiles[i], sketch.muged_quantile(quantiles[i]), 0.01);
+	ASSERT_EQUAL_DELTA(0, sketch.muged_quantile(0), 1e-12);
+	ASSERT_EQUAL_DELTA(9.9999, sketch.muged_quantile(1), 1e-12);
+
+	//Partial sketches of threads, one filled sample by sample
+	MUGED_QuantileSketch parts[4];
+	for (size_t p = 0; p < 4; p++)
+	{
+		muged_array part;
+		part.array = signal.muged_data() + p * length / 4;
+		part.length = length / 4;
+
+		if (p == 0)
+		{
+			for (size_t i = 0; i < part.length; i++)
+				parts[p].muged_add(part.array[i]);
+		}
+		else
+		{
+			parts[p].muged_add(part);
+		}
+	}
+
+	MUGED_QuantileSketch merged(MUGED_SKETCH_COMPRESSION);
+	for (size_t p = 0; p < 4; p++)
+		merged.muged_merge(parts[p]);
+
+	ASSERT_EQUAL(length, merged.muged_count());
+	ASSERT(merged.muged_centroids() <= MUGED_SKETCH_COMPRESSION + 2);
+	for (size_t i = 0; i < count; i++)
+		ASSERT_EQUAL_DELTA(10 * quantiles[i], merged.muged_quantile(quantiles[i]), 0.01);
+
+	//Memory doesn't grow with stream
+	for (size_t repeat = 0; repeat < 20; repeat++)
+		merged.muged_add(signal);
+	ASSERT(merged.muged_centroids() <= MUGED_SKETCH_COMPRESSION + 2);
+	ASSERT_EQUAL_DELTA(5, merged.muged_quantile(0.5), 0.05);
+
+	merged.muged_merge(merged);
+	ASSERT_EQUAL(42 * length, merged.muged_count());
+	ASSERT_EQUAL_DELTA(5, merged.muged_quantile(0.5), 0.05);
+
+	MUGED_QuantileSketch empty;
+	ASSERT_EQUAL_DELTA(0, empty.muged_quantile(0.5), 1e-12);
+
+	//Histogram with 10 equal bins of 10000 magnitudes
+	MUGED_Histogram histogram(0, 10, 10);
+	MUGED_Histogram first_half(0, 10, 10), second_half(0, 10, 10);
+
+	histogram.muged_add(signal);
+
+	muged_array half;
+	half.array = signal.muged_data();
+	half.length = length / 2;
+	first_half.muged_add(half);
+	half.array += half.length;
+	for (size_t i = 0; i < half.length; i++)
+		second_half.muged_add(half.array[i]);
+
+	first_half.muged_merge(second_half);
+
+	ASSERT_EQUAL(10u, histogram.muged_bins());
+	ASSERT_EQUAL(length, histogram.muged_total());
+	for (size_t b = 0; b < histogram.muged_bins(); b++)
+	{
+		ASSERT_EQUAL(length / 10, histogram.muged_count(b));
+		ASSERT_EQUAL(histogram.muged_count(b), first_half.muged_count(b));
+		ASSERT_EQUAL_DELTA(b, histogram.muged_edge(b), 1e-12);
+	}
+	ASSERT_EQUAL_DELTA(5, histogram.muged_quantile(0.5), 1e-9);
+	ASSERT_EQUAL_DELTA(9.99, histogram.muged_quantile(0.999), 1e-9);
+
+	//Out of range
+	histogram.muged_add(muged_scalar(10, 0));
+	histogram.muged_add(muged_scalar(NAN, 0));
+	ASSERT_EQUAL(1u, histogram.muged_overflow());
+	ASSERT_EQUAL(1u, histogram.muged_underflow());
+
+	bool thrown = false;
+	try
+	{
+		MUGED_Histogram other(0, 20, 10);
+		histogram.muged_merge(other);
+	}
+	catch (MUGED_DSPException* e)
+	{
+		thrown = true;
+		delete e;
+	}
+	ASSERT(thrown);
+
+	histogram.muged_reset();
+	ASSERT_EQUAL(0u, histogram.muged_total());
+}
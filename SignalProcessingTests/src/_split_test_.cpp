@@ -0,0 +1,132 @@
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+#include "MUGED_SIMD.h"
+
+/**
+ * Compares split-complex value with complex one
+ */
+static void _split_assert_(const muged_scalar& expected, const muged_split_array& split, size_t i)
+{
+	const double precision = 0.0001;
+
+	ASSERT_EQUAL_DELTA(expected.muged_real(), split.real[i], precision);
+	ASSERT_EQUAL_DELTA(expected.muged_imag(), split.imag != NULL ? split.imag[i] : 0, precision);
+}
+
+/**
+ * Compares split-complex FFT, statistics and correlation with the same
+ * operations on complex arrays
+ */
+static void _split_signal_test_(MUGED_DSP& dsp, muged_array& signal, muged_split_array& split)
+{
+	const double precision = 0.0001;
+
+	muged_array spectrum;
+	dsp.muged_1D_fft(signal, spectrum);
+
+	muged_split_array split_spectrum;
+	dsp.muged_1D_fft(split, split_spectrum);
+
+	ASSERT_EQUAL(spectrum.length, split_spectrum.length);
+	for (unsigned int i = 0; i < spectrum.length; i++)
+		_split_assert_(spectrum.array[i], split_spectrum, i);
+
+	muged_split_array split_ifft;
+	dsp.muged_1D_ifft(split_spectrum, split_ifft);
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		_split_assert_(signal.array[i], split_ifft, i);
+
+	muged_scalar expected[] = { dsp.muged_mean(signal), dsp.muged_mean_square(signal),
+	                            dsp.muged_root_mean_square(signal), dsp.muged_standard_deviation(signal) };
+	muged_scalar result[] = { dsp.muged_mean(split), dsp.muged_mean_square(split),
+	                          dsp.muged_root_mean_square(split), dsp.muged_standard_deviation(split) };
+
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		ASSERT_EQUAL_DELTA(expected[i].muged_real(), result[i].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(expected[i].muged_imag(), result[i].muged_imag(), precision);
+	}
+
+	muged_array correlation;
+	dsp.muged_1D_correlation(signal, signal, 2, 10, correlation);
+
+	muged_split_array split_correlation;
+	dsp.muged_1D_correlation(split, split, 2, 10, split_correlation);
+
+	ASSERT_EQUAL(correlation.length, split_correlation.length);
+	ASSERT_EQUAL(split.imag == NULL, split_correlation.imag == NULL);
+	for (unsigned int i = 0; i < correlation.length; i++)
+		_split_assert_(correlation.array[i], split_correlation, i);
+
+	delete [] spectrum.array;
+	delete [] correlation.array;
+	muged_split_free(split_spectrum);
+	muged_split_free(split_ifft);
+	muged_split_free(split_correlation);
+}
+
+/**
+ * Split-complex arrays test - conversion and operations compared with
+ * interleaved complex arrays, for every supported instruction set
+ */
+void _split_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+
+	muged_array signal;
+	_test_signal_(signal, 75, 0);
+
+	muged_array real_signal;
+	real_signal.length = signal.length;
+	real_signal.array = new muged_scalar[real_signal.length];
+
+	for (unsigned int i = 0; i < signal.length; i++)
+		real_signal.array[i] = muged_scalar(signal.array[i].muged_real(), 0);
+
+	MUGED_SIMDLevel supported = muged_simd_supported();
+	for (int level = MUGED_SIMD_SCALAR; level <= supported; level++)
+	{
+		muged_set_simd_level((MUGED_SIMDLevel)level);
+
+		//Conversion both ways, odd length checks tails of vector loops
+		muged_split_array split;
+		dsp.muged_to_split(signal, split);
+
+		ASSERT_EQUAL(signal.length, split.length);
+		ASSERT_EQUAL(0, (size_t)split.real % MUGED_ALIGNMENT);
+		ASSERT_EQUAL(0, (size_t)split.imag % MUGED_ALIGNMENT);
+		for (unsigned int i = 0; i < signal.length; i++)
+			_split_assert_(signal.array[i], split, i);
+
+		muged_array interleaved;
+		dsp.muged_from_split(split, interleaved);
+
+		for (unsigned int i = 0; i < signal.length; i++)
+			_split_assert_(interleaved.array[i], split, i);
+
+		_split_signal_test_(dsp, signal, split);
+
+		//Real signal without imaginary part
+		muged_split_array real_split;
+		muged_split_allocate(real_split, signal.length, false);
+		ASSERT(real_split.imag == NULL);
+
+		for (unsigned int i = 0; i < signal.length; i++)
+			real_split.real[i] = signal.array[i].muged_real();
+
+		_split_signal_test_(dsp, real_signal, real_split);
+
+		delete [] interleaved.array;
+		muged_split_free(split);
+		muged_split_free(real_split);
+	}
+	muged_set_simd_level(supported);
+
+	delete [] signal.array;
+	delete [] real_signal.array;
+
+	ASSERTM("Test shouldn't fails", true);
+}
@@ -0,0 +1,171 @@
+#include <vector>
+#include <stdint.h>
+
+#include "MUGED_Tests.h"
+#include "MUGED_DSP.h"
+#include "MUGED_SIMD.h"
+#include "MUGED_Parallel.h"
+
+/**
+ * Compares two complex values with tolerance
+ */
+static void _statistics_compare_(const muged_scalar& expected, const muged_scalar& result)
+{
+	ASSERT_EQUAL_DELTA(expected.muged_real(), result.muged_real(), 1e-9);
+	ASSERT_EQUAL_DELTA(expected.muged_imag(), result.muged_imag(), 1e-9);
+}
+
+/**
+ * Compares fused statistics with sums calculated sample by sample
+ */
+static void _statistics_signal_test_(MUGED_DSP& dsp, muged_array& signal)
+{
+	size_t length = signal.length;
+
+	muged_scalar sum, square_sum;
+	double norm_sum = 0, minimum = length > 0 ? HUGE_VAL : 0, maximum = 0;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		sum += signal.array[i];
+		square_sum += signal.array[i].muged_pow();
+		norm_sum += signal.array[i].muged_abs() * signal.array[i].muged_abs();
+
+		if (signal.array[i].muged_abs() < minimum)
+			minimum = signal.array[i].muged_abs();
+		if (signal.array[i].muged_abs() > maximum)
+			maximum = signal.array[i].muged_abs();
+	}
+
+	muged_statistics statistics = dsp.muged_signal_statistics(signal);
+	ASSERT_EQUAL(length, statistics.length);
+	ASSERT_EQUAL_DELTA(minimum, statistics.minimum, 1e-12);
+	ASSERT_EQUAL_DELTA(maximum, statistics.maximum, 1e-12);
+
+	if (length == 0)
+		return;
+
+	muged_scalar mean = sum / length;
+	muged_scalar mean_square = square_sum / length;
+
+	_statistics_compare_(mean, statistics.mean);
+	_statistics_compare_(mean_square, statistics.mean_square);
+	_statistics_compare_(muged_scalar(sqrt(norm_sum / length), 0), statistics.root_mean_square);
+	_statistics_compare_((mean_square - mean.muged_pow()).muged_sqrt(), statistics.standard_deviation);
+
+	//Single statistics are the same numbers
+	_statistics_compare_(statistics.mean, dsp.muged_mean(signal));
+	_statistics_compare_(statistics.mean_square, dsp.muged_mean_square(signal));
+	_statistics_compare_(statistics.root_mean_square, dsp.muged_root_mean_square(signal));
+	_statistics_compare_(statistics.standard_deviation, dsp.muged_standard_deviation(signal));
+}
+
+/**
+ * Statistics test - fused single pass statistics of every supported instruction
+ * set compared with sample by sample calculation
+ */
+void _statistics_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	MUGED_DSP dsp;
+
+	//Lengths check tails of vector loops of every width
+	const size_t lengths[] = { 0, 1, 2, 3, 5, 8, 13, 64, 1001 };
+
+	MUGED_SIMDLevel supported = muged_simd_supported();
+
+	for (unsigned int l = 0; l < sizeof(lengths)/sizeof(lengths[0]); l++)
+	{
+		MUGED_Array signal(lengths[l], MUGED_UNINITIALIZED);
+
+		for (size_t i = 0; i < signal.muged_length(); i++)
+			signal[i] = muged_scalar(2 * sin(0.21 * i) + (i % 3) - 1, cos(0.013 * i * i) - 0.25);
+
+		for (int level = MUGED_SIMD_SCALAR; level <= supported; level++)
+		{
+			muged_set_simd_level((MUGED_SIMDLevel)level);
+			_statistics_signal_test_(dsp, signal.muged_view());
+		}
+		muged_set_simd_level(supported);
+	}
+
+	//Long signal - the same bits for every number of threads
+	MUGED_Array long_signal(3 * MUGED_PARALLEL_LENGTH + 5, MUGED_UNINITIALIZED);
+	for (size_t i = 0; i < long_signal.muged_length(); i++)
+		long_signal[i] = muged_scalar(0.1 + sin(0.001 * i), 1e-3 * (i % 17));
+
+	//Float and int16 views are summed pairwise too
+	std::vector<float> float_iq(2 * long_signal.muged_length());
+	std::vector<int16_t> int16_iq(2 * long_signal.muged_length());
+	for (size_t i = 0; i < long_signal.muged_length(); i++)
+	{
+		float_iq[2*i] = (float)long_signal[i].muged_real();
+		float_iq[2*i + 1] = (float)long_signal[i].muged_imag();
+		int16_iq[2*i] = (int16_t)(i % 2001) - 1000;
+		int16_iq[2*i + 1] = (int16_t)(i % 13);
+	}
+	MUGED_SampleView float_view(&float_iq[0], long_signal.muged_length());
+	MUGED_SampleView int16_view(&int16_iq[0], long_signal.muged_length(), 1.0 / 1024);
+
+	size_t threads = muged_thread_count();
+	muged_set_thread_count(1);
+	muged_statistics single = dsp.muged_signal_statistics(long_signal.muged_view());
+	muged_statistics single_float = dsp.muged_signal_statistics(float_view);
+	muged_statistics single_int16 = dsp.muged_signal_statistics(int16_view);
+
+	ASSERT_EQUAL_DELTA(single.mean.muged_real(), single_float.mean.muged_real(), 1e-7);
+	ASSERT_EQUAL_DELTA(single.mean_square.muged_real(), single_float.mean_square.muged_real(), 1e-7);
+
+	for (size_t count = 2; count <= 5; count++)
+	{
+		muged_set_thread_count(count);
+		muged_statistics parallel = dsp.muged_signal_statistics(long_signal.muged_view());
+
+		ASSERT_EQUAL(single.mean.muged_real(), parallel.mean.muged_real());
+		ASSERT_EQUAL(single.mean.muged_imag(), parallel.mean.muged_imag());
+		ASSERT_EQUAL(single.mean_square.muged_real(), parallel.mean_square.muged_real());
+		ASSERT_EQUAL(single.root_mean_square.muged_real(), parallel.root_mean_square.muged_real());
+		ASSERT_EQUAL(single.maximum, parallel.maximum);
+
+		muged_statistics parallel_float = dsp.muged_signal_statistics(float_view);
+		muged_statistics parallel_int16 = dsp.muged_signal_statistics(int16_view);
+
+		ASSERT_EQUAL(single_float.mean.muged_real(), parallel_float.mean.muged_real());
+		ASSERT_EQUAL(single_float.mean_square.muged_real(), parallel_float.mean_square.muged_real());
+		ASSERT_EQUAL(single_float.standard_deviation.muged_real(), parallel_float.standard_deviation.muged_real());
+		ASSERT_EQUAL(single_int16.mean.muged_real(), parallel_int16.mean.muged_real());
+		ASSERT_EQUAL(single_int16.mean.muged_imag(), parallel_int16.mean.muged_imag());
+		ASSERT_EQUAL(single_int16.mean_square.muged_real(), parallel_int16.mean_square.muged_real());
+		ASSERT_EQUAL(single_int16.maximum, parallel_int16.maximum);
+	}
+	muged_set_thread_count(threads);
+
+	//Error doesn't grow with length (sequential sum is ~3e-14 off)
+	for (size_t i = 0; i < long_signal.muged_length(); i++)
+		long_signal[i] = muged_scalar(0.1, 0);
+
+	muged_statistics constant = dsp.muged_signal_statistics(long_signal.muged_view());
+	ASSERT_EQUAL_DELTA(0.1, constant.mean.muged_real(), 1e-15);
+	ASSERT_EQUAL_DELTA(0.01, constant.mean_square.muged_real(), 1e-16);
+
+	muged_split_array split;
+	muged_split_allocate(split, long_signal.muged_length());
+	for (size_t i = 0; i < split.length; i++)
+	{
+		split.real[i] = 0.1;
+		split.imag[i] = 0;
+	}
+	ASSERT_EQUAL_DELTA(0.1, dsp.muged_mean(split).muged_real(), 1e-15);
+	ASSERT_EQUAL_DELTA(0.1, dsp.muged_root_mean_square(split).muged_real(), 1e-15);
+	muged_split_free(split);
+
+	//Real signal in foreign format
+	int16_t samples[] = { 3, 0, -4, 0, 1, 0, 0, 0 };
+	muged_statistics statistics = dsp.muged_signal_statistics(MUGED_SampleView(samples, 4, 0.5));
+
+	ASSERT_EQUAL_DELTA(0, statistics.minimum, 1e-12);
+	ASSERT_EQUAL_DELTA(2, statistics.maximum, 1e-12);
+	ASSERT_EQUAL_DELTA(0, statistics.mean.muged_real(), 1e-12);
+	ASSERT_EQUAL_DELTA(6.5 / 4, statistics.mean_square.muged_real(), 1e-12);
+}
@@ -0,0 +1,142 @@
+#include <cfloat>
+
+#include "MUGED_Tests.h"
+#include "MUGED_VectorMath.h"
+#include "MUGED_SIMD.h"
+
+/**
+ * Compares polynomial approximations with libm on a grid of arguments
+ */
+static void _vector_fast_test_()
+{
+	const double precision = 4 * DBL_EPSILON;
+
+	for (int i = -4000; i <= 4000; i++)
+	{
+		double x = i * 0.0123;
+
+		ASSERT_EQUAL_DELTA(sin(x), muged_fast_sin(x), precision);
+		ASSERT_EQUAL_DELTA(cos(x), muged_fast_cos(x), precision);
+		ASSERT_EQUAL_DELTA(atan2(x, 1.7), muged_fast_atan2(x, 1.7), precision * 2);
+		ASSERT_EQUAL_DELTA(atan2(-1.7, x), muged_fast_atan2(-1.7, x), precision * 2);
+		ASSERT_EQUAL_DELTA(1, muged_fast_exp(x) / exp(x), precision);
+		ASSERT_EQUAL_DELTA(log(fabs(x) + 0.001), muged_fast_log(fabs(x) + 0.001), precision * 4);
+	}
+
+	//Arguments out of polynomial range
+	ASSERT_EQUAL(sin(1e7), muged_fast_sin(1e7));
+	ASSERT(muged_fast_exp(710) > DBL_MAX);
+	ASSERT_EQUAL(0, muged_fast_exp(-800));
+	ASSERT(muged_fast_log(0) < -DBL_MAX);
+	ASSERT(std::isnan(muged_fast_log(-1)));
+	ASSERT_EQUAL_DELTA(1, muged_fast_exp(-740) / exp(-740), 0.01);
+	ASSERT_EQUAL_DELTA(log(1e-310), muged_fast_log(1e-310), precision * 1000);
+
+	ASSERT_EQUAL(M_PI, muged_fast_atan2(0, -1));
+	ASSERT_EQUAL(-M_PI, muged_fast_atan2(-0.0, -1));
+	ASSERT_EQUAL(0, muged_fast_atan2(0, 0));
+}
+
+/**
+ * Compares element-wise operations with MUGED_Complex ones
+ */
+static void _vector_array_test_(muged_array& first, muged_array& second)
+{
+	const double precision = 1e-12;
+
+	muged_array sum, product, cross, scaled, conjugate, exponent, logarithm;
+	muged_real_array abs, abs2, angle;
+
+	muged_vector_add(first, second, sum);
+	muged_vector_multiply(first, second, product);
+	muged_vector_multiply_conj(first, second, cross);
+	muged_vector_scale(first, -2.5, scaled);
+	muged_vector_conj(first, conjugate);
+	muged_vector_abs(first, abs);
+	muged_vector_abs2(first, abs2);
+	muged_vector_angle(first, angle);
+	muged_vector_exp(first, exponent);
+	muged_vector_log(first, logarithm);
+
+	for (unsigned int i = 0; i < first.length; i++)
+	{
+		muged_scalar a = first.array[i];
+		muged_scalar b = second.array[i];
+
+		muged_scalar expected[] = { a + b, a * b, a * b.muged_conj(), a * muged_scalar(-2.5, 0), a.muged_conj() };
+		muged_scalar result[] = { sum.array[i], product.array[i], cross.array[i], scaled.array[i], conjugate.array[i] };
+
+		for (unsigned int j = 0; j < 5; j++)
+		{
+			ASSERT_EQUAL_DELTA(expected[j].muged_real(), result[j].muged_real(), precision);
+			ASSERT_EQUAL_DELTA(expected[j].muged_imag(), result[j].muged_imag(), precision);
+		}
+
+		ASSERT_EQUAL_DELTA(a.muged_abs(), abs.array[i], precision);
+		ASSERT_EQUAL_DELTA(a.muged_abs() * a.muged_abs(), abs2.array[i], precision);
+		ASSERT_EQUAL_DELTA(a.muged_angle(), angle.array[i], precision);
+
+		double magnitude = exp(a.muged_real());
+		ASSERT_EQUAL_DELTA(magnitude * cos(a.muged_imag()), exponent.array[i].muged_real(), precision * magnitude);
+		ASSERT_EQUAL_DELTA(magnitude * sin(a.muged_imag()), exponent.array[i].muged_imag(), precision * magnitude);
+
+		ASSERT_EQUAL_DELTA(log(a.muged_abs()), logarithm.array[i].muged_real(), precision);
+		ASSERT_EQUAL_DELTA(a.muged_angle(), logarithm.array[i].muged_imag(), precision);
+	}
+
+	delete [] sum.array;
+	delete [] product.array;
+	delete [] cross.array;
+	delete [] scaled.array;
+	delete [] conjugate.array;
+	delete [] abs.array;
+	delete [] abs2.array;
+	delete [] angle.array;
+	delete [] exponent.array;
+	delete [] logarithm.array;
+}
+
+/**
+ * Vector math test - polynomial approximations and element-wise operations
+ * of every supported instruction set
+ */
+void _vector_test_()
+{
+	ASSERTM("Test shouldn't fails", true);
+
+	_vector_fast_test_();
+
+	for (unsigned int l = 0; l < sizeof(_test_lengths_)/sizeof(_test_lengths_[0]); l++)
+	{
+		muged_array first, second;
+		_test_signal_(first, _test_lengths_[l], 0);
+		_test_signal_(second, _test_lengths_[l], 1);
+
+		MUGED_SIMDLevel supported = muged_simd_supported();
+		for (int level = MUGED_SIMD_SCALAR; level <= supported; level++)
+		{
+			muged_set_simd_level((MUGED_SIMDLevel)level);
+			_vector_array_test_(first, second);
+		}
+		muged_set_simd_level(supported);
+
+		delete [] first.array;
+		delete [] second.array;
+	}
+
+	//Arrays of different length
+	muged_array first, second;
+	_test_signal_(first, 4, 0);
+	_test_signal_(second, 5, 1);
+
+	ASSERT(_test_throws_([&]()
+	{
+		muged_array result;
+		muged_vector_add(first, second, result);
+	}));
+
+	delete [] first.array;
+	delete [] second.array;
+
+	ASSERTM("Test shouldn't fails", true);
+}